@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+#include "algorithm/count.hpp"
+#include "algorithm/equal.hpp"
+#include "iterator/bit_iterator.hpp"
+#include "measure.h"
+
+// Compares the standard algorithms over std::vector<bool> against the word-level overloads of stl_algorithm.
+// Usage: bit_benchmark [number of bits, default 1000000000]
+
+using stl_benchmark::measure;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000000u;
+
+    std::vector<bool> flags(n);
+    for (std::size_t i = 0; i < n; i += 3) {
+        flags[i] = true;
+    }
+    std::vector<bool> copy(flags);
+
+    measure("std::count", [&flags]() {
+        return std::count(flags.begin() + 1, flags.end(), true);
+    });
+
+    measure("stl_algorithm::count", [&flags]() {
+        return stl_algorithm::count(flags.begin() + 1, flags.end(), true);
+    });
+
+    measure("std::equal", [&flags, &copy]() {
+        return std::equal(flags.begin() + 1, flags.end(), copy.begin() + 1);
+    });
+
+    measure("stl_algorithm::equal", [&flags, &copy]() {
+        return stl_algorithm::equal(flags.begin() + 1, flags.end(), copy.begin() + 1);
+    });
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "algorithm/count.hpp"
+#include "index/counted_vector.hpp"
+#include "measure.h"
+
+// Compares count over a std::vector against counted_vector, for several ratios of counts to modifications.
+// The index wins as soon as a count is more expensive than the hash map updates of the modifications between counts.
+// Usage: count_index_benchmark [number of elements, default 1000] [number of operations, default 1000000]
+
+namespace {
+
+using stl_benchmark::measure;
+
+// Out of each reads + writes operations, counts a value reads times and replaces an element writes times.
+template <class Container, class Replace>
+long long run(Container& c, std::size_t operations, std::size_t reads, std::size_t writes, Replace replace)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> values(0, 99);
+    std::uniform_int_distribution<std::size_t> positions(0, c.size() - 1);
+    long long total = 0;
+    for (std::size_t i = 0; i < operations; ++i) {
+        if (i % (reads + writes) < reads) {
+            total += stl_algorithm::count(c.begin(), c.end(), values(random));
+        } else {
+            replace(c, positions(random), values(random));
+        }
+    }
+    return total;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000u;
+    const std::size_t operations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000u;
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> values(0, 99);
+    std::vector<int> initial(n);
+    for (int& value : initial) {
+        value = values(random);
+    }
+
+    const std::size_t ratios[][2] = {{1, 1000}, {1, 100}, {1, 10}, {1, 1}, {10, 1}};
+    for (const auto& ratio : ratios) {
+        std::cout << ratio[0] << " count(s) per " << ratio[1] << " modification(s)" << std::endl;
+
+        measure("  std::vector", [&]() {
+            std::vector<int> v(initial);
+            return run(v, operations, ratio[0], ratio[1], [](std::vector<int>& c, std::size_t i, int value) {
+                c[i] = value;
+            });
+        });
+
+        measure("  counted_vector", [&]() {
+            stl_index::counted_vector<int> v(initial.begin(), initial.end());
+            return run(v, operations, ratio[0], ratio[1],
+                [](stl_index::counted_vector<int>& c, std::size_t i, int value) {
+                    c.replace(c.begin() + static_cast<std::ptrdiff_t>(i), value);
+                });
+        });
+    }
+
+    return 0;
+}
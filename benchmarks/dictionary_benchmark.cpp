@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "algorithm/count.hpp"
+#include "algorithm/find.hpp"
+#include "iterator/dictionary_range.hpp"
+#include "measure.h"
+
+// Compares the standard algorithms over a string column against the overloads of stl_algorithm over the same column
+// encoded as a dictionary_range.
+// Usage: dictionary_benchmark [number of elements, default 20000000]
+
+using stl_benchmark::measure;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000u;
+
+    const std::string states[] = {"pending_review", "pending_payment", "shipped", "delivered", "cancelled"};
+    std::vector<std::string> values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = states[(i * 7 + i / 3) % 4];
+    }
+    values[n - 1] = states[4];
+    const stl_iterator::dictionary_range<std::string> column(values.begin(), values.end());
+    const std::string pending("pending_payment");
+    const std::string last(states[4]);
+
+    measure("std::count", [&values, &pending]() {
+        return std::count(values.begin(), values.end(), pending);
+    });
+
+    measure("stl_algorithm::count", [&column, &pending]() {
+        return stl_algorithm::count(column.begin(), column.end(), pending);
+    });
+
+    measure("std::find", [&values, &last]() {
+        return std::find(values.begin(), values.end(), last) - values.begin();
+    });
+
+    measure("stl_algorithm::find", [&column, &last]() {
+        return stl_algorithm::find(column.begin(), column.end(), last) - column.begin();
+    });
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "algorithm/estimate_count_if.hpp"
+#include "measure.h"
+
+// Compares std::count_if over an array of random 32-bit values against stl_algorithm::estimate_count_if with the
+// default number of samples and with a time budget of 1 ms, and prints the estimates with their 99% intervals.
+// Usage: estimate_benchmark [number of elements, default 268435456]
+
+namespace {
+
+using stl_benchmark::measure;
+
+std::string describe(const stl_algorithm::count_estimate& estimate)
+{
+    return std::to_string(estimate.count) + " in [" + std::to_string(estimate.lower) + ", " +
+        std::to_string(estimate.upper) + "] from " + std::to_string(estimate.samples) + " samples";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 28;
+
+    std::mt19937 random(1);
+    std::vector<std::uint32_t> values(n);
+    std::generate(values.begin(), values.end(), random);
+    auto selective = [](std::uint32_t v) { return v % 100 < 3; };
+
+    measure<std::chrono::microseconds>("std::count_if", [&values, &selective]() {
+        return std::count_if(values.begin(), values.end(), selective);
+    });
+
+    measure<std::chrono::microseconds>("estimate_count_if", [&values, &selective]() {
+        return describe(stl_algorithm::estimate_count_if(values.begin(), values.end(), selective, 0.99));
+    });
+
+    measure<std::chrono::microseconds>("estimate_count_if 1 ms", [&values, &selective]() {
+        return describe(stl_algorithm::estimate_count_if(
+            values.begin(), values.end(), selective, 0.99, std::chrono::milliseconds(1)));
+    });
+
+    return 0;
+}
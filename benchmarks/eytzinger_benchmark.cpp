@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "index/eytzinger_index.hpp"
+#include "measure.h"
+
+// Compares std::lower_bound over sorted arrays of 1K elements up to the given size, 4 times larger at each step,
+// against the lookups of stl_index::eytzinger_index. The arrays of 1G elements need about 8 GB.
+// Usage: eytzinger_benchmark [largest number of elements, default 1073741824] [number of lookups, default 1000000]
+
+using stl_benchmark::measure;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t largest = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 30;
+    const std::size_t lookups = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000u;
+
+    for (std::size_t n = 1024; n <= largest; n *= 4) {
+        std::vector<std::uint32_t> values(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i] = static_cast<std::uint32_t>(2 * i);
+        }
+        const auto index = stl_index::make_eytzinger_index(values.begin(), values.end());
+
+        std::mt19937 random(1);
+        std::vector<std::uint32_t> queries(lookups);
+        for (auto& q : queries) {
+            q = static_cast<std::uint32_t>(random() % (2 * n));
+        }
+
+        measure(std::to_string(n) + " std::lower_bound", [&values, &queries]() {
+            std::size_t sum = 0;
+            for (auto q : queries) {
+                sum += static_cast<std::size_t>(std::lower_bound(values.begin(), values.end(), q) - values.begin());
+            }
+            return sum;
+        });
+
+        measure(std::to_string(n) + " eytzinger_index", [&index, &queries]() {
+            std::size_t sum = 0;
+            for (auto q : queries) {
+                sum += index.rank(q);
+            }
+            return sum;
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "algorithm/lower_bound_interpolated.hpp"
+#include "measure.h"
+
+// Compares std::lower_bound against stl_algorithm::lower_bound_interpolated over sorted arrays of uniformly
+// distributed and of exponentially distributed 64-bit keys, and prints the probes per search of the latter.
+// Usage: interpolation_benchmark [number of elements, default 16777216] [number of lookups, default 1000000]
+
+namespace {
+
+using stl_benchmark::measure;
+
+void run(const std::string& name, std::vector<std::uint64_t>& values, std::size_t lookups)
+{
+    std::sort(values.begin(), values.end());
+    std::mt19937_64 random(2);
+    std::vector<std::uint64_t> queries(lookups);
+    for (auto& q : queries) {
+        q = values[random() % values.size()] + random() % 2;
+    }
+
+    measure(name + " std::lower_bound", [&values, &queries]() {
+        std::size_t sum = 0;
+        for (auto q : queries) {
+            sum += static_cast<std::size_t>(std::lower_bound(values.begin(), values.end(), q) - values.begin());
+        }
+        return sum;
+    });
+
+    stl_algorithm::interpolation_statistics stats;
+    measure(name + " lower_bound_interpolated", [&values, &queries, &stats]() {
+        std::size_t sum = 0;
+        for (auto q : queries) {
+            sum += static_cast<std::size_t>(
+                stl_algorithm::lower_bound_interpolated(values.begin(), values.end(), q, stats) - values.begin());
+        }
+        return sum;
+    });
+    std::cout << "  probes per search: "
+              << static_cast<double>(stats.interpolation_probes + stats.binary_probes) /
+                    static_cast<double>(stats.searches)
+              << ", fallbacks: " << stats.fallbacks << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 24;
+    const std::size_t lookups = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000u;
+
+    std::mt19937_64 random(1);
+    std::vector<std::uint64_t> values(n);
+    for (auto& v : values) {
+        v = random();
+    }
+    run("uniform", values, lookups);
+
+    std::exponential_distribution<double> exponential(1.0);
+    for (auto& v : values) {
+        v = static_cast<std::uint64_t>(exponential(random) * 1e15);
+    }
+    run("exponential", values, lookups);
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#ifndef __STL_BENCHMARKS_MEASURE_H__
+#define __STL_BENCHMARKS_MEASURE_H__
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace stl_benchmark {
+
+inline const char* unit(std::chrono::milliseconds)
+{
+    return "ms";
+}
+
+inline const char* unit(std::chrono::microseconds)
+{
+    return "us";
+}
+
+// Runs f once and prints its result with the wall time it took, in Duration units.
+template <class Duration = std::chrono::milliseconds, class F>
+void measure(const std::string& name, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto result = f();
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << name << ": " << result << " in " << std::chrono::duration_cast<Duration>(stop - start).count() << " "
+              << unit(Duration()) << std::endl;
+}
+
+} // namespace stl_benchmark
+
+#endif  // __STL_BENCHMARKS_MEASURE_H__
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "iterator/packed_range.hpp"
+#include "measure.h"
+
+// Compares decoding a packed series into a vector before calling the standard algorithms against the overloads of
+// stl_algorithm over the packed ranges.
+// Usage: packed_benchmark [number of elements, default 50000000]
+
+namespace {
+
+using stl_benchmark::measure;
+
+bool is_spike(std::int64_t v)
+{
+    return v % 1000 > 990;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000000u;
+
+    std::vector<std::int64_t> values(n);
+    std::int64_t t = 1600000000000;
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = t += 1000 + static_cast<std::int64_t>(i * 7919 % 13);
+    }
+    const stl_iterator::delta_range<std::int64_t> deltas(values.begin(), values.end());
+    const stl_iterator::frame_of_reference_range<std::int64_t> frames(values.begin(), values.end());
+    std::cout << "raw " << n * sizeof(std::int64_t) << " bytes, delta " << deltas.memory_usage() << " bytes, frame "
+              << frames.memory_usage() << " bytes" << std::endl;
+
+    measure("decode + std::count_if", [&deltas]() {
+        std::vector<std::int64_t> decoded(deltas.begin(), deltas.end());
+        return std::count_if(decoded.begin(), decoded.end(), is_spike);
+    });
+
+    measure("stl_algorithm::count_if delta", [&deltas]() {
+        return stl_algorithm::count_if(deltas.begin(), deltas.end(), is_spike);
+    });
+
+    measure("stl_algorithm::count_if frame", [&frames]() {
+        return stl_algorithm::count_if(frames.begin(), frames.end(), is_spike);
+    });
+
+    measure("decode + std::count", [&frames, &values]() {
+        std::vector<std::int64_t> decoded(frames.begin(), frames.end());
+        return std::count(decoded.begin(), decoded.end(), values[values.size() / 2]);
+    });
+
+    measure("stl_algorithm::count frame", [&frames, &values]() {
+        return stl_algorithm::count(frames.begin(), frames.end(), values[values.size() / 2]);
+    });
+
+    return 0;
+}
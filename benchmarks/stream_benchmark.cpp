@@ -0,0 +1,36 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include "algorithm/count.hpp"
+#include "iterator/chunked_input_iterator.hpp"
+#include "measure.h"
+
+// Compares count over a stream read with std::istreambuf_iterator against chunked_input_iterator.
+// Usage: stream_benchmark [number of characters, default 200000000]
+
+using stl_benchmark::measure;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000000u;
+
+    std::string text(n, 'x');
+    for (std::size_t i = 79; i < n; i += 80) {
+        text[i] = '\n';
+    }
+
+    measure("istreambuf_iterator", [&text]() {
+        std::istringstream is(text);
+        return stl_algorithm::count(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>(), '\n');
+    });
+
+    measure("chunked_input_iterator", [&text]() {
+        std::istringstream is(text);
+        return stl_algorithm::count(
+            stl_iterator::make_chunked_input_iterator(is), stl_iterator::chunked_input_iterator<char>(), '\n');
+    });
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "algorithm/count_if.hpp"
+#include "iterator/filter_iterator.hpp"
+#include "iterator/transform_iterator.hpp"
+#include "measure.h"
+
+// Compares filter -> transform -> count_if materializing intermediate vectors against the lazy views.
+// Usage: view_benchmark [number of elements, default 100000000]
+
+namespace {
+
+using stl_benchmark::measure;
+
+bool is_odd(std::int64_t i)
+{
+    return i % 2 != 0;
+}
+
+std::int64_t triple(std::int64_t i)
+{
+    return i * 3;
+}
+
+bool is_large(std::int64_t i)
+{
+    return i % 7 > 3;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000u;
+
+    std::vector<std::int64_t> input(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        input[i] = static_cast<std::int64_t>(i);
+    }
+
+    measure("materialized", [&input]() {
+        std::vector<std::int64_t> odds;
+        for (auto i : input) {
+            if (is_odd(i)) {
+                odds.push_back(i);
+            }
+        }
+        std::vector<std::int64_t> tripled;
+        tripled.reserve(odds.size());
+        for (auto i : odds) {
+            tripled.push_back(triple(i));
+        }
+        return stl_algorithm::count_if(tripled.begin(), tripled.end(), is_large);
+    });
+
+    measure("lazy", [&input]() {
+        auto view = stl_iterator::transformed(stl_iterator::filtered(input, is_odd), triple);
+        return stl_algorithm::count_if(view.begin(), view.end(), is_large);
+    });
+
+    return 0;
+}
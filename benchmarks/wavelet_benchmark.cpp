@@ -0,0 +1,71 @@
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+#include "algorithm/count.hpp"
+#include "index/wavelet_matrix.hpp"
+#include "measure.h"
+
+// Compares stl_algorithm::count over random subranges of an integer column against wavelet_matrix::count.
+// Usage: wavelet_benchmark [number of elements, default 10000000] [number of queries, default 1000]
+//     [number of distinct values, default 1000]
+
+using stl_benchmark::measure;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000u;
+    const std::size_t queries = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000u;
+    const int sigma = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+    std::mt19937 random(5);
+    std::uniform_int_distribution<int> values(0, sigma - 1);
+    std::vector<int> column(n);
+    for (int& value : column) {
+        value = values(random);
+    }
+
+    struct Query
+    {
+        std::size_t i;
+        std::size_t j;
+        int value;
+    };
+    std::uniform_int_distribution<std::size_t> positions(0, n);
+    std::vector<Query> workload(queries);
+    for (Query& query : workload) {
+        query.i = positions(random);
+        query.j = positions(random);
+        if (query.i > query.j) {
+            std::swap(query.i, query.j);
+        }
+        query.value = values(random);
+    }
+
+    measure("stl_algorithm::count", [&]() {
+        std::size_t total = 0;
+        for (const Query& query : workload) {
+            const auto first = column.begin() + static_cast<std::ptrdiff_t>(query.i);
+            const auto last = column.begin() + static_cast<std::ptrdiff_t>(query.j);
+            total += static_cast<std::size_t>(stl_algorithm::count(first, last, query.value));
+        }
+        return total;
+    });
+
+    stl_index::wavelet_matrix<int> index;
+    measure("wavelet_matrix construction, bytes", [&]() {
+        index = stl_index::wavelet_matrix<int>(column.begin(), column.end());
+        return index.memory_usage();
+    });
+
+    measure("wavelet_matrix::count", [&]() {
+        std::size_t total = 0;
+        for (const Query& query : workload) {
+            total += index.count(query.i, query.j, query.value);
+        }
+        return total;
+    });
+
+    return 0;
+}
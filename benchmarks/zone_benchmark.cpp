@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "algorithm/any_of.hpp"
+#include "algorithm/count_if.hpp"
+#include "index/zoned_vector.hpp"
+#include "measure.h"
+
+// Compares std::count_if with intervals covering 2% of the values and std::any_of with single values, over an array of
+// timestamps which mostly grow, against the same algorithms over a stl_index::zoned_vector of blocks of 4096 elements.
+// Usage: zone_benchmark [number of elements, default 134217728] [number of queries, default 20]
+
+using stl_benchmark::measure;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 27;
+    const std::size_t queries = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20u;
+
+    // Timestamps of events which arrive slightly out of order.
+    std::mt19937_64 random(1);
+    std::vector<std::int64_t> values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = static_cast<std::int64_t>(10 * i + random() % 1000);
+    }
+    const stl_index::zoned_vector<std::int64_t> zoned(values.begin(), values.end());
+
+    std::vector<stl_index::between<std::int64_t>> intervals;
+    const std::int64_t span = static_cast<std::int64_t>(n / 5);
+    for (std::size_t q = 0; q < queries; ++q) {
+        const std::int64_t low = static_cast<std::int64_t>(random() % (10 * n));
+        intervals.push_back(stl_index::make_between(low, low + span));
+    }
+
+    measure("std::count_if", [&values, &intervals]() {
+        std::ptrdiff_t sum = 0;
+        for (const auto& p : intervals) {
+            sum += std::count_if(values.begin(), values.end(), p);
+        }
+        return sum;
+    });
+
+    measure("zoned_vector count_if", [&zoned, &intervals]() {
+        std::ptrdiff_t sum = 0;
+        for (const auto& p : intervals) {
+            sum += stl_algorithm::count_if(zoned.begin(), zoned.end(), p);
+        }
+        return sum;
+    });
+
+    // Single timestamps, most of which are in no more than one block.
+    std::vector<stl_index::between<std::int64_t>> points;
+    for (std::size_t q = 0; q < queries; ++q) {
+        const std::int64_t point = static_cast<std::int64_t>(random() % (10 * n));
+        points.push_back(stl_index::make_between(point, point));
+    }
+
+    measure("std::any_of point", [&values, &points]() {
+        std::size_t found = 0;
+        for (const auto& p : points) {
+            found += std::any_of(values.begin(), values.end(), p) ? 1u : 0u;
+        }
+        return found;
+    });
+
+    measure("zoned_vector any_of point", [&zoned, &points]() {
+        std::size_t found = 0;
+        for (const auto& p : points) {
+            found += stl_algorithm::any_of(zoned.begin(), zoned.end(), p) ? 1u : 0u;
+        }
+        return found;
+    });
+
+    return 0;
+}
@@ -47,7 +47,13 @@ if(CMAKE_SYSTEM_NAME STREQUAL Windows)
 endif()
 
 # C++ standard
-set(CMAKE_CXX_STANDARD 11)
+# STL_CONCEPTS_CXX20 builds with C++20, which enables the coroutine generator of stl_iterator
+option(STL_CONCEPTS_CXX20 "Build with C++20" OFF)
+if(STL_CONCEPTS_CXX20)
+    set(CMAKE_CXX_STANDARD 20)
+else()
+    set(CMAKE_CXX_STANDARD 11)
+endif()
 set(CMAKE_CXX_STANDARD_REQUIRED ON)
 ###############################################################################
 
@@ -0,0 +1,92 @@
+/** @file */
+#ifndef __STL_ALGORITHM_COUNT_SORTED_HPP__
+#define __STL_ALGORITHM_COUNT_SORTED_HPP__
+
+#include <boost/concept/requires.hpp>
+#include "concept/compare.hpp"
+#include "concept/forward_iterator.hpp"
+#include "concept/less_than_comparable.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/sorted_search.hpp"
+
+namespace stl_algorithm {
+
+/**
+ * @brief Returns the number of elements in the sorted range [first, last) that are equivalent to value, which are
+ * neither less nor greater than it.
+ *
+ * <p>
+ * Random access ranges are searched by bisection in O(log n) comparisons. Other forward ranges are searched by
+ * galloping from first to the first equivalent element, then from it to the end of the equivalent elements, which
+ * takes O(log k) comparisons and O(k) increments, k being the distance of the last equivalent element from first.<br/>
+ * The elements less than value must precede the equivalent ones, which must precede the greater ones. In debug
+ * builds, when NDEBUG is not defined, this is checked on the elements the searches compare and on the neighbours of
+ * their results, which keeps the complexity.
+ * </p>
+ * @tparam ForwardIt - must meet the requirements of <i>stl_concept::ForwardIterator</i>.
+ * The value type of ForwardIt must meet the requirements of <i>stl_concept::LessThanComparable</i>.
+ * @tparam T - type which can be compared with the value type of ForwardIt by < operator, in both directions.
+ * @param first, last - the sorted range of elements to examine
+ * @param value - the value to search for
+ * @return number of elements equivalent to value
+ * @see https://en.cppreference.com/w/cpp/algorithm/equal_range
+ */
+#ifdef DOXYGEN_WORKING
+template <class ForwardIt, class T>
+inline auto count_sorted(ForwardIt first, ForwardIt last, const T& value)
+    -> decltype(typename std::iterator_traits<ForwardIt>::difference_type);
+#else // DOXYGEN_WORKING
+template <class ForwardIt, class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::ForwardIterator<ForwardIt>))
+        ((stl_concept::LessThanComparable<__detail::__iterator_value_t<ForwardIt>>))
+        ((stl_concept::Compare<__detail::__less, __detail::__iterator_value_t<ForwardIt>, T>)),
+        // Return
+        (__detail::__iterator_difference_t<ForwardIt>)
+    )
+inline count_sorted(ForwardIt first, ForwardIt last, const T& value)
+{
+    __detail::__less comp;
+    return __detail::__count_sorted(first, last, value, comp);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Returns the number of elements in the range [first, last), sorted with respect to comp, that are equivalent
+ * to value.
+ *
+ * <p>
+ * It searches like stl_algorithm::count_sorted(first, last, value), comparing the elements with comp instead of <
+ * operator.
+ * </p>
+ * @tparam ForwardIt - must meet the requirements of <i>stl_concept::ForwardIterator</i>.
+ * @tparam Compare - must meet the requirements of <i>stl_concept::Compare</i> for the value type of ForwardIt and T.
+ * @param first, last - the sorted range of elements to examine
+ * @param value - the value to search for
+ * @param comp - comparison function object which returns true if the first argument is ordered before the second
+ * @return number of elements equivalent to value
+ * @see https://en.cppreference.com/w/cpp/algorithm/equal_range
+ */
+#ifdef DOXYGEN_WORKING
+template <class ForwardIt, class T, class Compare>
+inline auto count_sorted(ForwardIt first, ForwardIt last, const T& value, Compare comp)
+    -> decltype(typename std::iterator_traits<ForwardIt>::difference_type);
+#else // DOXYGEN_WORKING
+template <class ForwardIt, class T, class Compare>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::ForwardIterator<ForwardIt>))
+        ((stl_concept::Compare<Compare, __detail::__iterator_value_t<ForwardIt>, T>)),
+        // Return
+        (__detail::__iterator_difference_t<ForwardIt>)
+    )
+inline count_sorted(ForwardIt first, ForwardIt last, const T& value, Compare comp)
+{
+    return __detail::__count_sorted(first, last, value, comp);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_COUNT_SORTED_HPP__
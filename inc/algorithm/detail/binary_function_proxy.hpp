@@ -13,14 +13,17 @@ namespace __detail {
 /**
  * @brief Proxy for using stl_concept::BinaryFunction
  *        with standard library algorithms applicable unary predicates and values.
+ *
+ * The arguments are checked with the reference types of the iterators, which is what the algorithms pass on
+ * dereference, so that iterators with proxy references are accepted.
  * @tparam BinaryFunction - binary function to be applied to algorithms
  * @tparam Iterator1, Iterator2 - iterators to be applied to algorithms
  */
 template <typename BinaryFunction, typename Iterator1, typename Iterator2>
 using __BinaryFunctionProxy = stl_concept::BinaryFunction<
     __FunctionObjectAdapter<BinaryFunction>,
-    __iterator_value_t<Iterator1>,
-    __iterator_value_t<Iterator2>>;
+    __iterator_reference_t<Iterator1>,
+    __iterator_reference_t<Iterator2>>;
 /// @endcond
 
 } // namespace __detail
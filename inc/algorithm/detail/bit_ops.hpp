@@ -0,0 +1,164 @@
+/** @file */
+#ifndef __STL_ALGORITHM_DETAIL_BIT_OPS_HPP__
+#define __STL_ALGORITHM_DETAIL_BIT_OPS_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace stl_algorithm {
+namespace __detail {
+
+/// @cond DEV
+/** @brief Returns the number of set bits of word. */
+inline unsigned __popcount(std::uint64_t word)
+{
+#if (defined __GNUC__)
+    return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+    word = word - ((word >> 1) & 0x5555555555555555u);
+    word = (word & 0x3333333333333333u) + ((word >> 2) & 0x3333333333333333u);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fu;
+    return static_cast<unsigned>((word * 0x0101010101010101u) >> 56);
+#endif
+}
+
+/** @brief Returns the index of the lowest set bit of a non-zero word. */
+inline unsigned __countr_zero(std::uint64_t word)
+{
+#if (defined __GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    return __popcount((word & (~word + 1)) - 1);
+#endif
+}
+
+/** @brief Returns the number of bits needed to represent word, 0 for 0. */
+inline unsigned __bit_width(std::uint64_t word)
+{
+#if (defined __GNUC__)
+    return word == 0 ? 0 : 64 - static_cast<unsigned>(__builtin_clzll(word));
+#else
+    unsigned width = 0;
+    for (; word != 0; word >>= 1) {
+        ++width;
+    }
+    return width;
+#endif
+}
+
+/** @brief Returns the index of the set bit of word which has k set bits below it, k must be less than the count. */
+inline unsigned __select_in_word(std::uint64_t word, unsigned k)
+{
+    // Skips whole bytes first, then clears the lowest bits of the remaining byte.
+    unsigned shift = 0;
+    for (;;) {
+        const unsigned ones = __popcount(word & 0xffu);
+        if (k < ones) {
+            break;
+        }
+        k -= ones;
+        word >>= 8;
+        shift += 8;
+    }
+    for (; k > 0; --k) {
+        word &= word - 1;
+    }
+    return shift + __countr_zero(word);
+}
+
+/** @brief Returns a word with the n lowest bits set, n must be at most 64. */
+inline std::uint64_t __low_mask(unsigned n)
+{
+    return n >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << n) - 1;
+}
+
+/**
+ * @brief Returns the n bits starting at bit offset of the word pointed by p, as the low bits of a 64-bit word.
+ *
+ * Only the words holding the n bits are read, n must be at most 64 and offset less than the digits of Word.
+ */
+template <class Word>
+inline std::uint64_t __load_bits(const Word* p, unsigned offset, unsigned n)
+{
+    constexpr unsigned __digits = std::numeric_limits<Word>::digits;
+    std::uint64_t result = 0;
+    for (unsigned loaded = 0; loaded < n; loaded += __digits - offset, offset = 0, ++p) {
+        result |= (static_cast<std::uint64_t>(*p) >> offset) << loaded;
+    }
+    return result & __low_mask(n);
+}
+
+/** @brief Moves the bit position (p, offset) n bits forward. */
+template <class Word>
+inline void __advance_bits(const Word*& p, unsigned& offset, std::size_t n)
+{
+    constexpr unsigned __digits = std::numeric_limits<Word>::digits;
+    const std::size_t bits = offset + n;
+    p += bits / __digits;
+    offset = static_cast<unsigned>(bits % __digits);
+}
+
+/** @brief Returns the number of set bits among the n bits starting at (p, offset), 64 bits at a time. */
+template <class Word>
+inline std::size_t __count_bits(const Word* p, unsigned offset, std::size_t n)
+{
+    std::size_t result = 0;
+    while (n > 0) {
+        const unsigned bits = n < 64 ? static_cast<unsigned>(n) : 64;
+        result += __popcount(__load_bits(p, offset, bits));
+        __advance_bits(p, offset, bits);
+        n -= bits;
+    }
+    return result;
+}
+
+/** @brief Returns the index of the first bit equal to value among the n bits starting at (p, offset), n if none. */
+template <class Word>
+inline std::size_t __find_bit(const Word* p, unsigned offset, std::size_t n, bool value)
+{
+    for (std::size_t i = 0; i < n;) {
+        const unsigned bits = n - i < 64 ? static_cast<unsigned>(n - i) : 64;
+        std::uint64_t word = __load_bits(p, offset, bits);
+        if (!value) {
+            word = ~word & __low_mask(bits);
+        }
+        if (word != 0) {
+            return i + __countr_zero(word);
+        }
+        __advance_bits(p, offset, bits);
+        i += bits;
+    }
+    return n;
+}
+
+/**
+ * @brief Returns the index of the first bit which differs between the n bits starting at (p1, offset1) and the n
+ * bits starting at (p2, offset2), n if none. The words are compared with XOR.
+ */
+template <class Word1, class Word2>
+inline std::size_t __mismatch_bits(
+    const Word1* p1,
+    unsigned offset1,
+    const Word2* p2,
+    unsigned offset2,
+    std::size_t n)
+{
+    for (std::size_t i = 0; i < n;) {
+        const unsigned bits = n - i < 64 ? static_cast<unsigned>(n - i) : 64;
+        const std::uint64_t diff = __load_bits(p1, offset1, bits) ^ __load_bits(p2, offset2, bits);
+        if (diff != 0) {
+            return i + __countr_zero(diff);
+        }
+        __advance_bits(p1, offset1, bits);
+        __advance_bits(p2, offset2, bits);
+        i += bits;
+    }
+    return n;
+}
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_DETAIL_BIT_OPS_HPP__
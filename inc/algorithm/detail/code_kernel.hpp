@@ -0,0 +1,113 @@
+/** @file */
+#ifndef __STL_ALGORITHM_DETAIL_CODE_KERNEL_HPP__
+#define __STL_ALGORITHM_DETAIL_CODE_KERNEL_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include "algorithm/detail/bit_ops.hpp"
+
+#if (defined __AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace stl_algorithm {
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Number of codes tested per block by the code kernels.
+ *
+ * The codes of a block are compared without branches into a bit mask, which the compiler vectorizes for narrow
+ * unsigned codes.
+ */
+constexpr std::size_t __code_block = 32;
+
+/** @brief Checks if code c matches key, which is a code or a table of the matching codes. */
+template <class Code>
+inline bool __code_match(Code c, Code code)
+{
+    return c == code;
+}
+
+template <class Code>
+inline bool __code_match(Code c, const bool* table)
+{
+    return table[c];
+}
+
+/** @brief Returns the bit mask of the codes of the block at p which are equal to code. */
+template <class Code>
+inline std::uint32_t __code_block_mask(const Code* p, Code code)
+{
+    std::uint32_t mask = 0;
+    for (std::size_t k = 0; k < __code_block; ++k) {
+        mask |= static_cast<std::uint32_t>(p[k] == code) << k;
+    }
+    return mask;
+}
+
+/** @brief Returns the bit mask of the codes of the block at p for which table is true. */
+template <class Code>
+inline std::uint32_t __code_block_mask(const Code* p, const bool* table)
+{
+    std::uint32_t mask = 0;
+    for (std::size_t k = 0; k < __code_block; ++k) {
+        mask |= static_cast<std::uint32_t>(table[p[k]]) << k;
+    }
+    return mask;
+}
+
+#if (defined __AVX2__)
+/** @brief Returns the bit mask of the 32 byte codes at p which are equal to code, with one AVX2 comparison. */
+inline std::uint32_t __code_block_mask(const std::uint8_t* p, std::uint8_t code)
+{
+    const __m256i codes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i equal = _mm256_cmpeq_epi8(codes, _mm256_set1_epi8(static_cast<char>(code)));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+}
+#endif
+
+/**
+ * @brief Returns the number of codes in [p, p + n) matching key, which is a code or a table of the matching codes.
+ */
+template <class Code, class Key>
+inline std::size_t __code_count(const Code* p, std::size_t n, Key key)
+{
+    std::size_t result = 0;
+    std::size_t i = 0;
+    for (; i + __code_block <= n; i += __code_block) {
+        result += __popcount(__code_block_mask(p + i, key));
+    }
+    for (; i < n; ++i) {
+        result += __code_match(p[i], key);
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the offset of the first code in [p, p + n) matching key, which is a code or a table of the matching
+ * codes, n if there is none.
+ */
+template <class Code, class Key>
+inline std::size_t __code_find(const Code* p, std::size_t n, Key key)
+{
+    std::size_t i = 0;
+    for (; i + __code_block <= n; i += __code_block) {
+        const std::uint32_t mask = __code_block_mask(p + i, key);
+        if (mask != 0) {
+            return i + __countr_zero(mask);
+        }
+    }
+    for (; i < n; ++i) {
+        if (__code_match(p[i], key)) {
+            return i;
+        }
+    }
+    return n;
+}
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_DETAIL_CODE_KERNEL_HPP__
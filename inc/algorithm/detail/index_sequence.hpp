@@ -0,0 +1,28 @@
+/** @file */
+#ifndef __STL_ALGORITHM_DETAIL_INDEX_SEQUENCE_HPP__
+#define __STL_ALGORITHM_DETAIL_INDEX_SEQUENCE_HPP__
+
+#include <cstddef>
+#include "iterator/detail/index_sequence.hpp"
+
+namespace stl_algorithm {
+namespace __detail {
+
+/// @cond DEV
+/** @brief Alias of stl_iterator::__detail::__index_sequence */
+template <std::size_t... I>
+using __index_sequence = stl_iterator::__detail::__index_sequence<I...>;
+
+/** @brief Alias of stl_iterator::__detail::__make_index_sequence */
+template <std::size_t N>
+using __make_index_sequence = stl_iterator::__detail::__make_index_sequence<N>;
+
+/** @brief Alias of stl_iterator::__detail::__index_sequence_for */
+template <class... T>
+using __index_sequence_for = stl_iterator::__detail::__index_sequence_for<T...>;
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_DETAIL_INDEX_SEQUENCE_HPP__
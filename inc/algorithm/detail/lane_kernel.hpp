@@ -0,0 +1,168 @@
+/** @file */
+#ifndef __STL_ALGORITHM_DETAIL_LANE_KERNEL_HPP__
+#define __STL_ALGORITHM_DETAIL_LANE_KERNEL_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "algorithm/detail/iterator_traits.hpp"
+
+#if (defined __AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace stl_algorithm {
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Number of elements loaded per block by the lane kernels.
+ *
+ * A block is gathered into a local buffer first, then tested, which lets the
+ * compiler keep the loads independent and vectorize the tests of count.
+ */
+constexpr std::ptrdiff_t __lane_count = 8;
+
+/**
+ * @brief Checks if the elements of Iterator can be gathered into a local buffer by the lane kernels.
+ * @tparam Iterator - random access iterator
+ */
+template <class Iterator>
+using __is_lane_gatherable = std::integral_constant<
+    bool,
+    std::is_trivial<__iterator_value_t<Iterator>>::value &&
+    std::is_base_of<std::random_access_iterator_tag, __iterator_category_t<Iterator>>::value>;
+
+/** @brief Returns the index of the lowest set bit of a non-zero lane mask. */
+inline std::ptrdiff_t __first_lane(unsigned mask)
+{
+    std::ptrdiff_t lane = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++lane;
+    }
+    return lane;
+}
+
+/**
+ * @brief Finds the first element in [first, first + n) for which p returns true, one block of lanes at a time.
+ *
+ * p is not called on the elements after the one found.
+ * @return offset of the found element, or n if no such element is found
+ */
+template <class RandomIt, class Predicate>
+inline __iterator_difference_t<RandomIt> __lane_find_if(
+    RandomIt first,
+    __iterator_difference_t<RandomIt> n,
+    Predicate& p)
+{
+    using __Difference = __iterator_difference_t<RandomIt>;
+    __iterator_value_t<RandomIt> lanes[__lane_count];
+
+    __Difference i = 0;
+    for (; i + __lane_count <= n; i += __lane_count) {
+        for (std::ptrdiff_t k = 0; k < __lane_count; ++k) {
+            lanes[k] = first[i + k];
+        }
+        // The lanes are tested in order and the search stops at the first match, like std::find_if.
+        for (std::ptrdiff_t k = 0; k < __lane_count; ++k) {
+            if (p(lanes[k])) {
+                return i + k;
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        if (p(first[i])) {
+            return i;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Counts the elements in [first, first + n) for which p returns true, one block of lanes at a time.
+ */
+template <class RandomIt, class Predicate>
+inline __iterator_difference_t<RandomIt> __lane_count_if(
+    RandomIt first,
+    __iterator_difference_t<RandomIt> n,
+    Predicate& p)
+{
+    using __Difference = __iterator_difference_t<RandomIt>;
+    __iterator_value_t<RandomIt> lanes[__lane_count];
+
+    __Difference count = 0;
+    __Difference i = 0;
+    for (; i + __lane_count <= n; i += __lane_count) {
+        for (std::ptrdiff_t k = 0; k < __lane_count; ++k) {
+            lanes[k] = first[i + k];
+        }
+        __Difference hits = 0;
+        for (std::ptrdiff_t k = 0; k < __lane_count; ++k) {
+            hits += static_cast<bool>(p(lanes[k]));
+        }
+        count += hits;
+    }
+    for (; i < n; ++i) {
+        count += static_cast<bool>(p(first[i]));
+    }
+    return count;
+}
+
+/**
+ * @brief Predicate comparing elements to a value, used to run count and find on the lane kernels.
+ * @tparam T - type of the value
+ */
+template <class T>
+struct __equal_to_value
+{
+    const T& value;
+
+    template <class U>
+    bool operator()(const U& u) const
+    {
+        return u == value;
+    }
+};
+
+#if (defined __AVX2__)
+/**
+ * @brief Checks if an element type and a value type can use the 32-bit AVX2 gather kernels.
+ */
+template <class T, class U>
+using __is_avx2_gather_int32 = std::integral_constant<
+    bool,
+    std::is_integral<T>::value && sizeof(T) == 4 &&
+    std::is_same<typename std::remove_cv<T>::type, U>::value>;
+
+/**
+ * @brief Gathers 8 32-bit lanes at base + lane * stride and returns the bit mask of lanes equal to value.
+ * @param stride - distance between two lanes in units of 4 bytes
+ */
+inline unsigned __avx2_gather_equal_mask(const void* base, std::int32_t stride, std::int32_t value)
+{
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+    const __m256i lanes = _mm256_i32gather_epi32(static_cast<const int*>(base), offsets, 4);
+    const __m256i equal = _mm256_cmpeq_epi32(lanes, _mm256_set1_epi32(value));
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+}
+
+/**
+ * @brief Counts the lanes equal to value in a mask returned by __avx2_gather_equal_mask.
+ */
+inline std::ptrdiff_t __lane_mask_count(unsigned mask)
+{
+    std::ptrdiff_t count = 0;
+    for (; mask; mask &= mask - 1) {
+        ++count;
+    }
+    return count;
+}
+#endif // __AVX2__
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_DETAIL_LANE_KERNEL_HPP__
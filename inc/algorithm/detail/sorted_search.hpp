@@ -0,0 +1,198 @@
+/** @file */
+#ifndef __STL_ALGORITHM_DETAIL_SORTED_SEARCH_HPP__
+#define __STL_ALGORITHM_DETAIL_SORTED_SEARCH_HPP__
+
+#include <cassert>
+#include <iterator>
+#include "algorithm/detail/iterator_traits.hpp"
+
+namespace stl_algorithm {
+namespace __detail {
+
+/// @cond DEV
+/** @brief Function object comparing its arguments with < operator, which may have different types. */
+struct __less
+{
+    template <class T, class U>
+    bool operator()(const T& lhs, const U& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+/**
+ * @brief Partition predicate of the sorted searches, true for the elements whose rank with respect to value is below
+ * Bound, the rank being 0 for the elements less than value, 1 for the equivalent ones and 2 for the greater ones.
+ *
+ * In debug builds, it checks that the ranks of the elements it tests are sorted, the searches testing the elements
+ * before the partition point from left to right and the ones after it from right to left. Only the elements the
+ * search reads anyway are checked, so that the search keeps its complexity.
+ */
+template <int Bound, class T, class Compare>
+class __rank_below
+{
+public:
+    __rank_below(const T& value, Compare& comp) noexcept
+        : value_(value)
+        , comp_(comp)
+        , low_(0)
+        , high_(2)
+    {
+    }
+
+    template <class U>
+    bool operator()(const U& u)
+    {
+#ifndef NDEBUG
+        const int rank = this->rank(u);
+        const bool below = rank < Bound;
+        assert((below ? low_ <= rank : rank <= high_) && "stl_algorithm: the range is not sorted");
+        (below ? low_ : high_) = rank;
+        return below;
+#else
+        return Bound == 1 ? comp_(u, value_) : !comp_(value_, u);
+#endif
+    }
+
+    /**
+     * @brief Checks in debug builds the neighbours of result, the partition point of [first, last) found with this
+     * predicate: the element before it, when the iterators are bidirectional, and the element after it.
+     */
+    template <class ForwardIt>
+    void check_partition_point(ForwardIt first, ForwardIt result, ForwardIt last)
+    {
+#ifndef NDEBUG
+        check_previous(first, result, __iterator_category_t<ForwardIt>());
+        if (result != last) {
+            const int rank = this->rank(*result);
+            assert(Bound <= rank && rank <= high_ && "stl_algorithm: the range is not sorted");
+            const ForwardIt next = std::next(result);
+            assert((next == last || rank <= this->rank(*next)) && "stl_algorithm: the range is not sorted");
+        }
+#else
+        (void)first;
+        (void)result;
+        (void)last;
+#endif
+    }
+
+private:
+    template <class U>
+    int rank(const U& u) const
+    {
+        return comp_(u, value_) ? 0 : comp_(value_, u) ? 2 : 1;
+    }
+
+    template <class ForwardIt>
+    void check_previous(ForwardIt, ForwardIt, std::forward_iterator_tag) const
+    {
+    }
+
+    template <class BidirIt>
+    void check_previous(BidirIt first, BidirIt result, std::bidirectional_iterator_tag) const
+    {
+        if (result != first) {
+            const int rank = this->rank(*std::prev(result));
+            assert(low_ <= rank && rank < Bound && "stl_algorithm: the range is not sorted");
+            (void)rank;
+        }
+    }
+
+    const T& value_;
+    Compare& comp_;
+    int low_;
+    int high_;
+};
+
+/**
+ * @brief Returns the first element of the n elements from first for which pred returns false, pred being true for a
+ * prefix of the range only, searching it by bisection in O(log n) calls to pred.
+ */
+template <class ForwardIt, class Predicate>
+inline ForwardIt __bisect_partition_point(ForwardIt first, __iterator_difference_t<ForwardIt> n, Predicate& pred)
+{
+    while (n > 0) {
+        const __iterator_difference_t<ForwardIt> half = n / 2;
+        ForwardIt middle = std::next(first, half);
+        if (pred(*middle)) {
+            first = ++middle;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return first;
+}
+
+/**
+ * @brief Returns the first element of [first, last) for which pred returns false, pred being true for a prefix of the
+ * range only.
+ *
+ * The element is bracketed by windows of 1, 2, 4... elements from first, then searched by bisection in the last
+ * window, so that it takes O(log k) calls to pred, k being its distance from first.
+ */
+template <class ForwardIt, class Predicate>
+inline ForwardIt __partition_point(ForwardIt first, ForwardIt last, Predicate& pred, std::forward_iterator_tag)
+{
+    for (__iterator_difference_t<ForwardIt> step = 1;; step *= 2) {
+        ForwardIt probe = first;
+        ForwardIt next = first;
+        __iterator_difference_t<ForwardIt> n = 0;
+        for (; n < step && next != last; ++n) {
+            probe = next++;
+        }
+        if (n == 0) {
+            return first;
+        }
+        if (!pred(*probe)) {
+            return __bisect_partition_point(first, n - 1, pred);
+        }
+        first = next;
+        if (n < step) {
+            return first;
+        }
+    }
+}
+
+template <class RandomIt, class Predicate>
+inline RandomIt __partition_point(RandomIt first, RandomIt last, Predicate& pred, std::random_access_iterator_tag)
+{
+    return __bisect_partition_point(first, last - first, pred);
+}
+
+/**
+ * @brief Returns the first element of the sorted range [first, last) whose rank with respect to value, as defined by
+ * __rank_below, is not below Bound.
+ */
+template <int Bound, class ForwardIt, class T, class Compare>
+inline ForwardIt __sorted_partition_point(ForwardIt first, ForwardIt last, const T& value, Compare& comp)
+{
+    __rank_below<Bound, T, Compare> pred(value, comp);
+    const ForwardIt result = __partition_point(first, last, pred, __iterator_category_t<ForwardIt>());
+    pred.check_partition_point(first, result, last);
+    return result;
+}
+
+template <class ForwardIt, class T, class Compare>
+inline ForwardIt __find_sorted(ForwardIt first, ForwardIt last, const T& value, Compare& comp)
+{
+    first = __sorted_partition_point<1>(first, last, value, comp);
+    return first != last && !comp(value, *first) ? first : last;
+}
+
+template <class ForwardIt, class T, class Compare>
+inline __iterator_difference_t<ForwardIt> __count_sorted(
+    ForwardIt first,
+    ForwardIt last,
+    const T& value,
+    Compare& comp)
+{
+    first = __sorted_partition_point<1>(first, last, value, comp);
+    return std::distance(first, __sorted_partition_point<2>(first, last, value, comp));
+}
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_DETAIL_SORTED_SEARCH_HPP__
@@ -13,13 +13,16 @@ namespace __detail {
 /**
  * @brief Proxy for using stl_concept::UnaryFunction with standard library algorithms applicable unary predicates and
  * values.
+ *
+ * The arguments are checked with the reference types of the iterators, which is what the algorithms pass on
+ * dereference, so that iterators with proxy references are accepted.
  * @tparam UnaryFunction - unary function to be applied to algorithms
  * @tparam Iterator - iterator to be applied to algorithms
  */
 template <typename UnaryFunction, typename Iterator>
 using __UnaryFunctionProxy = stl_concept::UnaryFunction<
     __FunctionObjectAdapter<UnaryFunction>,
-    __iterator_value_t<Iterator>>;
+    __iterator_reference_t<Iterator>>;
 /// @endcond
 
 } // namespace __detail
@@ -13,13 +13,16 @@ namespace __detail {
 /**
  * @brief Proxy for using stl_concept::UnaryPredicate with standard library algorithms applicable unary predicates and
  * values.
+ *
+ * The arguments are checked with the reference types of the iterators, which is what the algorithms pass on
+ * dereference, so that iterators with proxy references are accepted.
  * @tparam UnaryPredicate - unary predicate to be applied to algorithms
  * @tparam Iterator - iterator to be applied to algorithms
  */
 template <typename UnaryPredicate, typename Iterator>
 using __UnaryPredicateProxy = stl_concept::UnaryPredicate<
     __FunctionObjectAdapter<UnaryPredicate>,
-    __iterator_value_t<Iterator>>;
+    __iterator_reference_t<Iterator>>;
 /// @endcond
 
 } // namespace __detail
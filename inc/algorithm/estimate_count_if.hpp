@@ -0,0 +1,422 @@
+/** @file */
+#ifndef __STL_ALGORITHM_ESTIMATE_COUNT_IF_HPP__
+#define __STL_ALGORITHM_ESTIMATE_COUNT_IF_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <boost/concept/requires.hpp>
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_algorithm {
+
+/** @brief Result of stl_algorithm::estimate_count_if. */
+struct count_estimate
+{
+    /** @brief Estimated number of elements satisfying the predicate. */
+    double count;
+    /** @brief Lower bound of the confidence interval. */
+    double lower;
+    /** @brief Upper bound of the confidence interval. */
+    double upper;
+    /** @brief Number of elements on which the predicate was called. */
+    std::size_t samples;
+    /** @brief Whether every element was examined, count is then exact and equal to both bounds. */
+    bool exact;
+};
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Number of samples of estimate_count_if when no sample count or time budget is given. */
+constexpr std::size_t __estimate_default_samples = 4096;
+
+/** @brief Maximum number of strata the range is divided into. */
+constexpr std::size_t __estimate_strata = 32;
+
+/** @brief Number of samples drawn in each stratum between two reads of the clock. */
+constexpr std::size_t __estimate_round_samples = 32;
+
+/**
+ * @brief SplitMix64 generator, which meets the requirements of UniformRandomBitGenerator and is much cheaper than
+ * std::mt19937_64 to create and to run.
+ */
+class __splitmix64
+{
+public:
+    using result_type = std::uint64_t;
+
+    explicit __splitmix64(std::uint64_t seed)
+        : state_(seed)
+    {
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()()
+    {
+        std::uint64_t z = (state_ += 0x9e3779b97f4a7c15u);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+        return z ^ (z >> 31);
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+/**
+ * @brief Returns a seed of the internal generator which differs on each call: the time of the steady clock, mixed
+ * with the number of calls so that the calls within the same tick of the clock differ too.
+ */
+inline std::uint64_t __random_seed()
+{
+    static std::atomic<std::uint64_t> calls(0);
+    const auto now = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return now ^ (++calls * 0xbf58476d1ce4e5b9u);
+}
+
+/**
+ * @brief Returns z such that a standard normal variable lies in [-z, z] with the given probability.
+ *
+ * Rational approximation 26.2.23 of Abramowitz and Stegun, its absolute error is below 4.5e-4.
+ */
+inline double __normal_quantile(double confidence)
+{
+    if (!(confidence > 0.0 && confidence < 1.0)) {
+        throw std::out_of_range("stl_algorithm::estimate_count_if: confidence must be in (0, 1)");
+    }
+    const double t = std::sqrt(-2.0 * std::log((1.0 - confidence) / 2.0));
+    return t - (2.515517 + 0.802853 * t + 0.010328 * t * t) /
+        (1.0 + 1.432788 * t + 0.189269 * t * t + 0.001308 * t * t * t);
+}
+
+/**
+ * @brief Samples [first, first + n), divided into strata of equal sizes, uniformly and with replacement in each
+ * stratum, and estimates the number of elements satisfying the predicate from the proportions of the strata.
+ */
+template <class RandomIt, class UnaryPredicate>
+class __stratified_sampler
+{
+public:
+    __stratified_sampler(RandomIt first, std::size_t n, UnaryPredicate& p)
+        : first_(first)
+        , n_(n)
+        , strata_(std::min(n, __estimate_strata))
+        , p_(p)
+        , hits_()
+        , draws_(0)
+    {
+    }
+
+    /** @brief Returns the number of elements of the range. */
+    std::size_t size() const
+    {
+        return n_;
+    }
+
+    /** @brief Returns the number of elements sampled so far. */
+    std::size_t samples() const
+    {
+        return draws_ * strata_;
+    }
+
+    /** @brief Samples per_stratum more elements in each stratum. */
+    template <class URBG>
+    void draw(std::size_t per_stratum, URBG& g)
+    {
+        for (std::size_t h = 0; h < strata_; ++h) {
+            const std::size_t begin = stratum_begin(h);
+            std::uniform_int_distribution<std::size_t> position(begin, stratum_begin(h + 1) - 1);
+            std::size_t hits = 0;
+            for (std::size_t i = 0; i < per_stratum; ++i) {
+                hits += p_(first_[static_cast<__iterator_difference_t<RandomIt>>(position(g))]) ? 1u : 0u;
+            }
+            hits_[h] += hits;
+        }
+        draws_ += per_stratum;
+    }
+
+    /**
+     * @brief Returns the estimate with its interval of half-width z standard deviations.
+     *
+     * The variance of each stratum is estimated with one more hit and one more miss than sampled, so that the strata
+     * in which the predicate was always true or always false still widen the interval.
+     */
+    count_estimate estimate(double z) const
+    {
+        double count = 0.0;
+        double variance = 0.0;
+        for (std::size_t h = 0; h < strata_; ++h) {
+            const double size = static_cast<double>(stratum_begin(h + 1) - stratum_begin(h));
+            const double draws = static_cast<double>(draws_);
+            const double smoothed = (static_cast<double>(hits_[h]) + 1.0) / (draws + 2.0);
+            count += size * static_cast<double>(hits_[h]) / draws;
+            variance += size * size * smoothed * (1.0 - smoothed) / draws;
+        }
+        const double margin = z * std::sqrt(variance);
+        return count_estimate{
+            count,
+            std::max(0.0, count - margin),
+            std::min(static_cast<double>(n_), count + margin),
+            samples(),
+            false};
+    }
+
+    /** @brief Examines every element and returns the exact count. */
+    count_estimate count() const
+    {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < n_; ++i) {
+            hits += p_(first_[static_cast<__iterator_difference_t<RandomIt>>(i)]) ? 1u : 0u;
+        }
+        const double count = static_cast<double>(hits);
+        return count_estimate{count, count, count, n_, true};
+    }
+
+private:
+    std::size_t stratum_begin(std::size_t h) const
+    {
+        // Strata sizes differ by one element at most.
+        return n_ / strata_ * h + std::min(h, n_ % strata_);
+    }
+
+    RandomIt first_;
+    std::size_t n_;
+    std::size_t strata_;
+    UnaryPredicate& p_;
+    std::size_t hits_[__estimate_strata];
+    std::size_t draws_;
+};
+
+template <class RandomIt, class UnaryPredicate, class URBG>
+inline count_estimate __estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate& p,
+    double confidence,
+    std::size_t samples,
+    URBG& g)
+{
+    const double z = __normal_quantile(confidence);
+    __stratified_sampler<RandomIt, UnaryPredicate> sampler(first, static_cast<std::size_t>(last - first), p);
+    const std::size_t strata = std::min(sampler.size(), __estimate_strata);
+    const std::size_t per_stratum = std::max<std::size_t>(2, (samples + strata - 1) / std::max<std::size_t>(strata, 1));
+    if (per_stratum * strata >= sampler.size()) {
+        return sampler.count();
+    }
+    sampler.draw(per_stratum, g);
+    return sampler.estimate(z);
+}
+
+template <class RandomIt, class UnaryPredicate, class URBG, class Clock, class Duration>
+inline count_estimate __estimate_count_until(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate& p,
+    double confidence,
+    const std::chrono::time_point<Clock, Duration>& deadline,
+    URBG& g)
+{
+    const double z = __normal_quantile(confidence);
+    __stratified_sampler<RandomIt, UnaryPredicate> sampler(first, static_cast<std::size_t>(last - first), p);
+    const std::size_t round = std::min(sampler.size(), __estimate_strata) * __estimate_round_samples;
+    // The clock is read once per round, the elements are all examined once sampling would cost as much.
+    do {
+        if (sampler.samples() + round >= sampler.size()) {
+            return sampler.count();
+        }
+        sampler.draw(__estimate_round_samples, g);
+    } while (Clock::now() < deadline);
+    return sampler.estimate(z);
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Estimates the number of elements in the range [first, last) for which predicate p returns true, by
+ * stratified random sampling.
+ *
+ * <p>
+ * The range is divided into at most 32 strata of equal sizes, and the same number of elements is sampled uniformly in
+ * each stratum, which is never less accurate than sampling the whole range and much more accurate when the matching
+ * elements are clustered. The count is estimated from the proportion of matches of each stratum, with an interval
+ * which contains the exact count with probability confidence, by normal approximation.<br/>
+ * When the samples would be as many as the elements, the elements are all examined and the count is exact.<br/>
+ * The samples are drawn with an internal random generator seeded differently on each call, so that repeated calls
+ * sample different elements. The overloads taking a random generator give reproducible estimates.
+ * </p>
+ * ```
+ * auto estimate = stl_algorithm::estimate_count_if(rows.begin(), rows.end(), is_active, 0.95);
+ * std::cout << estimate.count << " in [" << estimate.lower << ", " << estimate.upper << "]\n";
+ * ```
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * @tparam UnaryPredicate - must meet the requirements of <i>stl_concept::UnaryPredicate</i>.
+ * @param first, last - the range of elements to examine
+ * @param p - unary predicate which returns ​true for the required elements
+ * @param confidence - probability that the interval contains the exact count, in (0, 1)
+ * @return count_estimate with the estimated count, its confidence interval and the number of elements examined
+ * @exception std::out_of_range - confidence is not in (0, 1)
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate>
+inline count_estimate estimate_count_if(RandomIt first, RandomIt last, UnaryPredicate p, double confidence);
+#else // DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, RandomIt>)),
+        // Return
+        (count_estimate)
+    )
+inline estimate_count_if(RandomIt first, RandomIt last, UnaryPredicate p, double confidence)
+{
+    __detail::__splitmix64 g(__detail::__random_seed());
+    return __detail::__estimate_count_if(first, last, p, confidence, __detail::__estimate_default_samples, g);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Estimates the number of elements in the range [first, last) for which predicate p returns true, from about
+ * the given number of samples drawn with the random generator g.
+ * @tparam URBG - must meet the requirements of <i>UniformRandomBitGenerator</i>.
+ * @param samples - number of samples, rounded up to a multiple of the number of strata and to 2 per stratum
+ * @param g - random generator which selects the samples
+ * @see stl_algorithm::estimate_count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate, class URBG>
+inline count_estimate estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p,
+    double confidence,
+    std::size_t samples,
+    URBG&& g);
+#else // DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate, class URBG>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, RandomIt>)),
+        // Return
+        (count_estimate)
+    )
+inline estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p,
+    double confidence,
+    std::size_t samples,
+    URBG&& g)
+{
+    return __detail::__estimate_count_if(first, last, p, confidence, samples, g);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Estimates the number of elements in the range [first, last) for which predicate p returns true, refining
+ * the estimate with more samples until the deadline.
+ *
+ * <p>
+ * The samples are drawn by rounds of 32 per stratum and the clock is read after each round, so the deadline may be
+ * exceeded by the time of a round and the estimate has at least one round of samples.
+ * </p>
+ * @param deadline - time point of Clock after which no more round is started
+ * @param g - random generator which selects the samples
+ * @see stl_algorithm::estimate_count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate, class Clock, class Duration, class URBG>
+inline count_estimate estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p,
+    double confidence,
+    const std::chrono::time_point<Clock, Duration>& deadline,
+    URBG&& g);
+#else // DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate, class Clock, class Duration, class URBG>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, RandomIt>)),
+        // Return
+        (count_estimate)
+    )
+inline estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p,
+    double confidence,
+    const std::chrono::time_point<Clock, Duration>& deadline,
+    URBG&& g)
+{
+    return __detail::__estimate_count_until(first, last, p, confidence, deadline, g);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Estimates the number of elements in the range [first, last) for which predicate p returns true, refining
+ * the estimate with more samples for the given duration.
+ *
+ * <p>
+ * Same as the deadline overload with the deadline std::chrono::steady_clock::now() + budget and the internal random
+ * generator.
+ * </p>
+ * @param budget - duration after which no more round of samples is started
+ * @see stl_algorithm::estimate_count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate, class Rep, class Period>
+inline count_estimate estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p,
+    double confidence,
+    const std::chrono::duration<Rep, Period>& budget);
+#else // DOXYGEN_WORKING
+template <class RandomIt, class UnaryPredicate, class Rep, class Period>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, RandomIt>)),
+        // Return
+        (count_estimate)
+    )
+inline estimate_count_if(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p,
+    double confidence,
+    const std::chrono::duration<Rep, Period>& budget)
+{
+    const auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(budget);
+    __detail::__splitmix64 g(__detail::__random_seed());
+    return __detail::__estimate_count_until(first, last, p, confidence, deadline, g);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_ESTIMATE_COUNT_IF_HPP__
@@ -0,0 +1,85 @@
+/** @file */
+#ifndef __STL_ALGORITHM_FIND_INTERPOLATED_HPP__
+#define __STL_ALGORITHM_FIND_INTERPOLATED_HPP__
+
+#include <cstddef>
+#include <boost/concept/requires.hpp>
+#include "concept/integral.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/lower_bound_interpolated.hpp"
+
+namespace stl_algorithm {
+
+/**
+ * @brief Returns the first element in the sorted range [first, last) that equals to value, found by interpolation
+ * search.
+ *
+ * <p>
+ * It searches like stl_algorithm::lower_bound_interpolated, then checks the element found.
+ * </p>
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * The value type of RandomIt must meet the requirements of <i>stl_concept::Integral</i>.
+ * @param first, last - the sorted range of elements to examine
+ * @param value - the value to compare the elements to
+ * @return Iterator to the first element equal to value or last if no such element is found.
+ * @see stl_algorithm::lower_bound_interpolated
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt>
+inline RandomIt find_interpolated(
+    RandomIt first,
+    RandomIt last,
+    const typename std::iterator_traits<RandomIt>::value_type& value);
+#else // DOXYGEN_WORKING
+template <class RandomIt>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((stl_concept::Integral<__detail::__iterator_value_t<RandomIt>>)),
+        // Return
+        (RandomIt)
+    )
+inline find_interpolated(RandomIt first, RandomIt last, const __detail::__iterator_value_t<RandomIt>& value)
+{
+    interpolation_statistics stats;
+    return find_interpolated(first, last, value, stats);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Returns the first element in the sorted range [first, last) that equals to value, found by interpolation
+ * search, and adds its probes to stats.
+ * @param stats - statistics to which the probes of the search are added
+ * @see stl_algorithm::find_interpolated
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt>
+inline RandomIt find_interpolated(
+    RandomIt first,
+    RandomIt last,
+    const typename std::iterator_traits<RandomIt>::value_type& value,
+    interpolation_statistics& stats);
+#else // DOXYGEN_WORKING
+template <class RandomIt>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((stl_concept::Integral<__detail::__iterator_value_t<RandomIt>>)),
+        // Return
+        (RandomIt)
+    )
+inline find_interpolated(
+    RandomIt first,
+    RandomIt last,
+    const __detail::__iterator_value_t<RandomIt>& value,
+    interpolation_statistics& stats)
+{
+    const RandomIt it = lower_bound_interpolated(first, last, value, stats);
+    return it != last && *it == value ? it : last;
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_FIND_INTERPOLATED_HPP__
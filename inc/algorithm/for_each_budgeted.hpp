@@ -0,0 +1,223 @@
+/** @file */
+#ifndef __STL_ALGORITHM_FOR_EACH_BUDGETED_HPP__
+#define __STL_ALGORITHM_FOR_EACH_BUDGETED_HPP__
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <boost/concept/requires.hpp>
+#include "concept/input_iterator.hpp"
+#include "concept/move_constructible.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_function_proxy.hpp"
+
+namespace stl_algorithm {
+
+/**
+ * @brief Result of stl_algorithm::for_each_budgeted.
+ * @tparam InputIt - iterator type
+ * @tparam UnaryFunction - function object type
+ */
+template <class InputIt, class UnaryFunction>
+struct for_each_budgeted_result
+{
+    /** @brief Iterator to the first element not processed, last if the whole range was processed. */
+    InputIt in;
+    /** @brief Function object, with the state accumulated on the processed elements. */
+    UnaryFunction fun;
+};
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Number of elements processed between two reads of the clock. */
+constexpr std::ptrdiff_t __budget_check_interval = 1024;
+
+/** @brief Applies f to at most n elements of [first, last), returns the iterator past the last one processed. */
+template <class RandomIt, class UnaryFunction>
+inline RandomIt __for_each_bounded(
+    RandomIt first,
+    RandomIt last,
+    UnaryFunction& f,
+    std::ptrdiff_t n,
+    std::true_type)
+{
+    const RandomIt stop = first + static_cast<__iterator_difference_t<RandomIt>>(
+        std::min<std::ptrdiff_t>(n, static_cast<std::ptrdiff_t>(last - first)));
+    std::for_each(first, stop, std::ref(f));
+    return stop;
+}
+
+template <class InputIt, class UnaryFunction>
+inline InputIt __for_each_bounded(
+    InputIt first,
+    InputIt last,
+    UnaryFunction& f,
+    std::ptrdiff_t n,
+    std::false_type)
+{
+    for (; n > 0 && first != last; --n, ++first) {
+        f(*first);
+    }
+    return first;
+}
+
+template <class Iterator>
+using __is_random_access_iterator = std::is_base_of<
+    std::random_access_iterator_tag,
+    __iterator_category_t<Iterator>>;
+
+template <class InputIt, class UnaryFunction, class Clock, class Duration>
+inline for_each_budgeted_result<InputIt, UnaryFunction> __for_each_until(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    const std::chrono::time_point<Clock, Duration>& deadline)
+{
+    // The clock is read once per block, so that its cost is amortized over the elements of the block.
+    while (first != last) {
+        first = __for_each_bounded(first, last, f, __budget_check_interval, __is_random_access_iterator<InputIt>());
+        if (Clock::now() >= deadline) {
+            break;
+        }
+    }
+    return for_each_budgeted_result<InputIt, UnaryFunction>{std::move(first), std::move(f)};
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Applies the function object f to the elements of [first, last) in order, until the deadline.
+ *
+ * <p>
+ * It lets a long pass run in slices, for example from an event loop which must not block: each call processes the
+ * elements until the deadline and returns where to resume with the function object and its state.<br/>
+ * The clock is read after each block of 1024 elements, so the deadline may be exceeded by the time of a block and
+ * each call processes at least one block.
+ * </p>
+ * ```
+ * auto result = stl_algorithm::for_each_budgeted(first, last, f, std::chrono::milliseconds(1));
+ * if (result.in != last) {
+ *     // reschedule for_each_budgeted(result.in, last, std::move(result.fun), budget)
+ * }
+ * ```
+ * @tparam InputIt - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ * @tparam UnaryFunction - must meet the requirements of <i>stl_concept::UnaryFunction</i>.
+ * @param first, last - the range of elements to process
+ * @param f - function object, to be applied to the result of dereferencing every iterator processed
+ * @param deadline - time point of Clock after which no more block is started
+ * @return for_each_budgeted_result with the iterator to the first element not processed and the function object
+ * @see stl_algorithm::for_each
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class UnaryFunction, class Clock, class Duration>
+inline for_each_budgeted_result<InputIt, UnaryFunction> for_each_budgeted(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    const std::chrono::time_point<Clock, Duration>& deadline);
+#else // DOXYGEN_WORKING
+template <class InputIt, class UnaryFunction, class Clock, class Duration>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>))
+        ((stl_concept::MoveConstructible<UnaryFunction>))
+        ((__detail::__UnaryFunctionProxy<UnaryFunction, InputIt>)),
+        // Return
+        (for_each_budgeted_result<InputIt, UnaryFunction>)
+    )
+inline for_each_budgeted(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    const std::chrono::time_point<Clock, Duration>& deadline)
+{
+    return __detail::__for_each_until(std::move(first), std::move(last), std::move(f), deadline);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Applies the function object f to the elements of [first, last) in order, for the given duration.
+ *
+ * <p>
+ * Same as the deadline overload with the deadline std::chrono::steady_clock::now() + budget.
+ * </p>
+ * @param budget - duration after which no more block is started
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class UnaryFunction, class Rep, class Period>
+inline for_each_budgeted_result<InputIt, UnaryFunction> for_each_budgeted(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    const std::chrono::duration<Rep, Period>& budget);
+#else // DOXYGEN_WORKING
+template <class InputIt, class UnaryFunction, class Rep, class Period>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>))
+        ((stl_concept::MoveConstructible<UnaryFunction>))
+        ((__detail::__UnaryFunctionProxy<UnaryFunction, InputIt>)),
+        // Return
+        (for_each_budgeted_result<InputIt, UnaryFunction>)
+    )
+inline for_each_budgeted(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    const std::chrono::duration<Rep, Period>& budget)
+{
+    const auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(budget);
+    return __detail::__for_each_until(std::move(first), std::move(last), std::move(f), deadline);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Applies the function object f to at most budget elements of [first, last) in order.
+ *
+ * <p>
+ * The count of elements is a deterministic budget, the clock is not read.
+ * </p>
+ * @param budget - maximum number of elements to process
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class UnaryFunction>
+inline for_each_budgeted_result<InputIt, UnaryFunction> for_each_budgeted(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    std::size_t budget);
+#else // DOXYGEN_WORKING
+template <class InputIt, class UnaryFunction>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>))
+        ((stl_concept::MoveConstructible<UnaryFunction>))
+        ((__detail::__UnaryFunctionProxy<UnaryFunction, InputIt>)),
+        // Return
+        (for_each_budgeted_result<InputIt, UnaryFunction>)
+    )
+inline for_each_budgeted(
+    InputIt first,
+    InputIt last,
+    UnaryFunction f,
+    std::size_t budget)
+{
+    const std::ptrdiff_t n = budget > static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max())
+        ? std::numeric_limits<std::ptrdiff_t>::max()
+        : static_cast<std::ptrdiff_t>(budget);
+    first = __detail::__for_each_bounded(first, last, f, n, __detail::__is_random_access_iterator<InputIt>());
+    return for_each_budgeted_result<InputIt, UnaryFunction>{std::move(first), std::move(f)};
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_FOR_EACH_BUDGETED_HPP__
@@ -0,0 +1,458 @@
+/** @file */
+#ifndef __STL_ALGORITHM_FUSED_QUERY_HPP__
+#define __STL_ALGORITHM_FUSED_QUERY_HPP__
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/forward_iterator.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/index_sequence.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_algorithm {
+
+/**
+ * @brief Algorithm descriptors evaluated together by stl_algorithm::fused_query.
+ *
+ * <p>
+ * Each descriptor holds the arguments of the algorithm it stands for, except the range.
+ * </p>
+ */
+namespace query {
+
+/** @brief Descriptor of stl_algorithm::count_if, the result is the number of matching elements. */
+template <class UnaryPredicate>
+struct count_if_query
+{
+    UnaryPredicate p;
+};
+
+/** @brief Descriptor of stl_algorithm::count, the result is the number of elements equal to value. */
+template <class T>
+struct count_query
+{
+    T value;
+};
+
+/** @brief Descriptor of stl_algorithm::find_if, the result is the iterator to the first matching element. */
+template <class UnaryPredicate>
+struct find_if_query
+{
+    UnaryPredicate p;
+};
+
+/** @brief Descriptor of stl_algorithm::find, the result is the iterator to the first element equal to value. */
+template <class T>
+struct find_query
+{
+    T value;
+};
+
+/** @brief Descriptor of stl_algorithm::all_of, the result is true if p returns true for all elements. */
+template <class UnaryPredicate>
+struct all_of_query
+{
+    UnaryPredicate p;
+};
+
+/** @brief Descriptor of stl_algorithm::any_of, the result is true if p returns true for any element. */
+template <class UnaryPredicate>
+struct any_of_query
+{
+    UnaryPredicate p;
+};
+
+/** @brief Descriptor of stl_algorithm::none_of, the result is true if p returns true for no elements. */
+template <class UnaryPredicate>
+struct none_of_query
+{
+    UnaryPredicate p;
+};
+
+/** @brief Creates a count_if_query. */
+template <class UnaryPredicate>
+inline count_if_query<UnaryPredicate> count_if(UnaryPredicate p)
+{
+    return count_if_query<UnaryPredicate>{p};
+}
+
+/** @brief Creates a count_query. */
+template <class T>
+inline count_query<T> count(const T& value)
+{
+    return count_query<T>{value};
+}
+
+/** @brief Creates a find_if_query. */
+template <class UnaryPredicate>
+inline find_if_query<UnaryPredicate> find_if(UnaryPredicate p)
+{
+    return find_if_query<UnaryPredicate>{p};
+}
+
+/** @brief Creates a find_query. */
+template <class T>
+inline find_query<T> find(const T& value)
+{
+    return find_query<T>{value};
+}
+
+/** @brief Creates an all_of_query. */
+template <class UnaryPredicate>
+inline all_of_query<UnaryPredicate> all_of(UnaryPredicate p)
+{
+    return all_of_query<UnaryPredicate>{p};
+}
+
+/** @brief Creates an any_of_query. */
+template <class UnaryPredicate>
+inline any_of_query<UnaryPredicate> any_of(UnaryPredicate p)
+{
+    return any_of_query<UnaryPredicate>{p};
+}
+
+/** @brief Creates a none_of_query. */
+template <class UnaryPredicate>
+inline none_of_query<UnaryPredicate> none_of(UnaryPredicate p)
+{
+    return none_of_query<UnaryPredicate>{p};
+}
+
+} // namespace query
+
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Evaluation state of a query descriptor over a range of InputIt.
+ *
+ * <p>
+ * Each specialization checks the requirements of the algorithm it stands for, and provides
+ * <ul style="list-style-type:disc">
+ *   <li>result_type, the return type of the algorithm</li>
+ *   <li>decidable, true if the result may be decided before the end of the range</li>
+ *   <li>step(it, x), evaluates the element x at it and returns true if it decides the result</li>
+ *   <li>result(last), the result of the algorithm</li>
+ * </ul>
+ * </p>
+ */
+template <class Query, class InputIt>
+struct __query_state;
+
+template <class UnaryPredicate, class InputIt>
+struct __query_state<query::count_if_query<UnaryPredicate>, InputIt>
+{
+    BOOST_CONCEPT_ASSERT((__UnaryPredicateProxy<UnaryPredicate, InputIt>));
+
+    using result_type = __iterator_difference_t<InputIt>;
+    static constexpr bool decidable = false;
+
+    explicit __query_state(const query::count_if_query<UnaryPredicate>& q)
+        : p(q.p)
+        , count(0)
+    {}
+
+    template <class Reference>
+    bool step(const InputIt&, Reference& x)
+    {
+        count += static_cast<bool>(p(x));
+        return false;
+    }
+
+    result_type result(const InputIt&) const
+    {
+        return count;
+    }
+
+    UnaryPredicate p;
+    result_type count;
+};
+
+template <class T, class InputIt>
+struct __query_state<query::count_query<T>, InputIt>
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::EqualityComparableWith<__iterator_value_t<InputIt>, T>));
+
+    using result_type = __iterator_difference_t<InputIt>;
+    static constexpr bool decidable = false;
+
+    explicit __query_state(const query::count_query<T>& q)
+        : value(q.value)
+        , count(0)
+    {}
+
+    template <class Reference>
+    bool step(const InputIt&, Reference& x)
+    {
+        count += static_cast<bool>(x == value);
+        return false;
+    }
+
+    result_type result(const InputIt&) const
+    {
+        return count;
+    }
+
+    T value;
+    result_type count;
+};
+
+template <class UnaryPredicate, class InputIt>
+struct __query_state<query::find_if_query<UnaryPredicate>, InputIt>
+{
+    // The found position must stay valid while the traversal goes on.
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<InputIt>));
+    BOOST_CONCEPT_ASSERT((__UnaryPredicateProxy<UnaryPredicate, InputIt>));
+
+    using result_type = InputIt;
+    static constexpr bool decidable = true;
+
+    explicit __query_state(const query::find_if_query<UnaryPredicate>& q)
+        : p(q.p)
+        , found(false)
+        , pos()
+    {}
+
+    template <class Reference>
+    bool step(const InputIt& it, Reference& x)
+    {
+        if (!found && p(x)) {
+            found = true;
+            pos = it;
+            return true;
+        }
+        return false;
+    }
+
+    result_type result(const InputIt& last) const
+    {
+        return found ? pos : last;
+    }
+
+    UnaryPredicate p;
+    bool found;
+    InputIt pos;
+};
+
+template <class T, class InputIt>
+struct __query_state<query::find_query<T>, InputIt>
+{
+    // The found position must stay valid while the traversal goes on.
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<InputIt>));
+    BOOST_CONCEPT_ASSERT((stl_concept::EqualityComparableWith<__iterator_value_t<InputIt>, T>));
+
+    using result_type = InputIt;
+    static constexpr bool decidable = true;
+
+    explicit __query_state(const query::find_query<T>& q)
+        : value(q.value)
+        , found(false)
+        , pos()
+    {}
+
+    template <class Reference>
+    bool step(const InputIt& it, Reference& x)
+    {
+        if (!found && x == value) {
+            found = true;
+            pos = it;
+            return true;
+        }
+        return false;
+    }
+
+    result_type result(const InputIt& last) const
+    {
+        return found ? pos : last;
+    }
+
+    T value;
+    bool found;
+    InputIt pos;
+};
+
+template <class UnaryPredicate, class InputIt>
+struct __query_state<query::all_of_query<UnaryPredicate>, InputIt>
+{
+    BOOST_CONCEPT_ASSERT((__UnaryPredicateProxy<UnaryPredicate, InputIt>));
+
+    using result_type = bool;
+    static constexpr bool decidable = true;
+
+    explicit __query_state(const query::all_of_query<UnaryPredicate>& q)
+        : p(q.p)
+        , decided(false)
+    {}
+
+    template <class Reference>
+    bool step(const InputIt&, Reference& x)
+    {
+        if (!decided && !p(x)) {
+            decided = true;
+            return true;
+        }
+        return false;
+    }
+
+    result_type result(const InputIt&) const
+    {
+        return !decided;
+    }
+
+    UnaryPredicate p;
+    bool decided;
+};
+
+template <class UnaryPredicate, class InputIt>
+struct __query_state<query::any_of_query<UnaryPredicate>, InputIt>
+{
+    BOOST_CONCEPT_ASSERT((__UnaryPredicateProxy<UnaryPredicate, InputIt>));
+
+    using result_type = bool;
+    static constexpr bool decidable = true;
+
+    explicit __query_state(const query::any_of_query<UnaryPredicate>& q)
+        : p(q.p)
+        , decided(false)
+    {}
+
+    template <class Reference>
+    bool step(const InputIt&, Reference& x)
+    {
+        if (!decided && p(x)) {
+            decided = true;
+            return true;
+        }
+        return false;
+    }
+
+    result_type result(const InputIt&) const
+    {
+        return decided;
+    }
+
+    UnaryPredicate p;
+    bool decided;
+};
+
+template <class UnaryPredicate, class InputIt>
+struct __query_state<query::none_of_query<UnaryPredicate>, InputIt>
+{
+    BOOST_CONCEPT_ASSERT((__UnaryPredicateProxy<UnaryPredicate, InputIt>));
+
+    using result_type = bool;
+    static constexpr bool decidable = true;
+
+    explicit __query_state(const query::none_of_query<UnaryPredicate>& q)
+        : p(q.p)
+        , decided(false)
+    {}
+
+    template <class Reference>
+    bool step(const InputIt&, Reference& x)
+    {
+        if (!decided && p(x)) {
+            decided = true;
+            return true;
+        }
+        return false;
+    }
+
+    result_type result(const InputIt&) const
+    {
+        return !decided;
+    }
+
+    UnaryPredicate p;
+    bool decided;
+};
+
+/** @brief Number of query descriptors whose result may be decided before the end of the range. */
+template <class InputIt, class... Queries>
+struct __decidable_count;
+
+template <class InputIt>
+struct __decidable_count<InputIt>
+    : std::integral_constant<std::size_t, 0> {};
+
+template <class InputIt, class Query, class... Queries>
+struct __decidable_count<InputIt, Query, Queries...>
+    : std::integral_constant<std::size_t,
+        (__query_state<Query, InputIt>::decidable ? 1 : 0) + __decidable_count<InputIt, Queries...>::value> {};
+
+template <class InputIt, class... Queries>
+using __fused_result_t = std::tuple<typename __query_state<Queries, InputIt>::result_type...>;
+
+template <class InputIt, class... Queries, std::size_t... I>
+inline __fused_result_t<InputIt, Queries...> __fused_query(
+    InputIt first,
+    InputIt last,
+    const std::tuple<Queries...>& queries,
+    __index_sequence<I...>)
+{
+    using __Swallow = std::size_t[];
+    std::tuple<__query_state<Queries, InputIt>...> states(std::get<I>(queries)...);
+
+    // When every query may be decided early, the traversal stops once all of them are decided.
+    constexpr std::size_t decidable = __decidable_count<InputIt, Queries...>::value;
+    constexpr bool stoppable = decidable == sizeof...(Queries);
+    std::size_t pending = decidable;
+
+    for (; first != last && (!stoppable || pending != 0); ++first) {
+        auto&& x = *first;
+        std::size_t decided = 0;
+        (void)__Swallow{0, (decided += std::get<I>(states).step(first, x))...};
+        pending -= decided;
+    }
+    return __fused_result_t<InputIt, Queries...>(std::get<I>(states).result(last)...);
+}
+/// @endcond
+
+} // namespace __detail
+
+/**
+ * @brief Evaluates several algorithms over the range [first, last) in a single traversal.
+ *
+ * <p>
+ * The queries are algorithm descriptors created by the functions in namespace <i>stl_algorithm::query</i>, such as
+ * query::count_if(p1), query::find_if(p2) and query::all_of(p3).<br/>
+ * Each element is dereferenced once and passed to every query which is not decided yet. A query stops being
+ * evaluated once its result is decided, such as the first hit of any_of or find_if. When every query can be decided
+ * early, the traversal stops as soon as all of them are decided.<br/>
+ * Each query checks the same requirements as the algorithm it stands for. Queries returning an iterator, find and
+ * find_if, additionally require InputIt to meet the requirements of <i>stl_concept::ForwardIterator</i>.
+ * </p>
+ * @tparam InputIt - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ * @tparam Queries - algorithm descriptors in namespace <i>stl_algorithm::query</i>
+ * @param first, last - the range of elements to examine
+ * @param queries - the algorithm descriptors to be evaluated
+ * @return std::tuple of the results, in the order of the queries, each of the same type and value as the result of
+ * the corresponding algorithm on [first, last)
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class... Queries>
+inline auto fused_query(InputIt first, InputIt last, const std::tuple<Queries...>& queries)
+    -> decltype(std::tuple<QueryResults...>);
+#else // DOXYGEN_WORKING
+template <class InputIt, class... Queries>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>)),
+        // Return
+        (__detail::__fused_result_t<InputIt, Queries...>)
+    )
+inline fused_query(InputIt first, InputIt last, const std::tuple<Queries...>& queries)
+{
+    return __detail::__fused_query(first, last, queries, __detail::__index_sequence_for<Queries...>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_FUSED_QUERY_HPP__
@@ -0,0 +1,255 @@
+/** @file */
+#ifndef __STL_ALGORITHM_LOWER_BOUND_INTERPOLATED_HPP__
+#define __STL_ALGORITHM_LOWER_BOUND_INTERPOLATED_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <boost/concept/requires.hpp>
+#include "concept/integral.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+
+namespace stl_algorithm {
+
+/**
+ * @brief Probe counters of stl_algorithm::lower_bound_interpolated and stl_algorithm::find_interpolated, accumulated
+ * over the searches it is given to.
+ */
+struct interpolation_statistics
+{
+    /** @brief Number of searches. */
+    std::size_t searches = 0;
+    /** @brief Number of elements read by the interpolation steps, the first and the last ones included. */
+    std::size_t interpolation_probes = 0;
+    /** @brief Number of elements read by the bisection which ends the searches. */
+    std::size_t binary_probes = 0;
+    /** @brief Number of searches which stopped interpolating because the distribution was found skewed. */
+    std::size_t fallbacks = 0;
+};
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Interpolation stops when the remaining range has at most this number of elements. */
+constexpr std::size_t __interpolation_cutoff = 16;
+
+/** @brief Maps an integer to a 64-bit unsigned integer of the same order. */
+template <class T>
+inline std::uint64_t __order_key(T value, std::true_type)
+{
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(value)) ^ (std::uint64_t(1) << 63);
+}
+
+template <class T>
+inline std::uint64_t __order_key(T value, std::false_type)
+{
+    return static_cast<std::uint64_t>(value);
+}
+
+template <class T>
+inline std::uint64_t __order_key(T value)
+{
+    return __order_key(value, std::is_signed<T>());
+}
+
+/**
+ * @brief Returns the offset of the first element of the sorted range [first, first + n) which is not less than value,
+ * the elements before lo being known less than value and the ones from hi being known not less.
+ *
+ * The bisection runs over the whole range and only reads the midpoints between lo and hi, so that it reads the same
+ * elements as std::lower_bound, whose first midpoints stay in the cache from one search to the next.
+ */
+template <class RandomIt>
+inline std::size_t __bisect_within(
+    RandomIt first,
+    std::size_t n,
+    std::size_t lo,
+    std::size_t hi,
+    const __iterator_value_t<RandomIt>& value,
+    interpolation_statistics& stats)
+{
+    std::size_t base = 0;
+    for (std::size_t size = n; size > 0;) {
+        const std::size_t half = size / 2;
+        const std::size_t mid = base + half;
+        bool less = mid < lo;
+        if (mid >= lo && mid < hi) {
+            ++stats.binary_probes;
+            less = first[static_cast<__iterator_difference_t<RandomIt>>(mid)] < value;
+        }
+        if (less) {
+            base = mid + 1;
+            size -= half + 1;
+        } else {
+            size = half;
+        }
+    }
+    return base;
+}
+
+/**
+ * @brief Returns the offset of the first element of the sorted range [first, first + n) which is not less than value.
+ *
+ * Each step reads the element at the position interpolated between the keys of the ends of the remaining range, then
+ * the element a guard distance further towards value, so that the step brackets value when the estimate is close.
+ * When a step leaves more than half of the range, the distribution is taken as skewed and the search continues by
+ * bisection, as it does when at most __interpolation_cutoff elements remain.
+ */
+template <class RandomIt>
+inline std::size_t __lower_bound_interpolated(
+    RandomIt first,
+    std::size_t n,
+    const __iterator_value_t<RandomIt>& value,
+    interpolation_statistics& stats)
+{
+    using __Difference = __iterator_difference_t<RandomIt>;
+    ++stats.searches;
+    const std::uint64_t key = __order_key(value);
+    if (n == 0) {
+        return 0;
+    }
+    std::uint64_t low_key = __order_key(first[0]);
+    std::uint64_t high_key = __order_key(first[static_cast<__Difference>(n - 1)]);
+    stats.interpolation_probes += 2;
+    if (key <= low_key) {
+        return 0;
+    }
+    if (key > high_key) {
+        return n;
+    }
+    // Elements before lo are less than value, the ones from hi are not, low_key and high_key are the keys of the
+    // elements at lo - 1 and hi.
+    std::size_t lo = 1;
+    std::size_t hi = n - 1;
+    while (hi - lo > __interpolation_cutoff) {
+        const std::size_t size = hi - lo;
+        // The estimate is expected within sqrt(size) / 2 of value for uniformly distributed keys.
+        const std::size_t deviation = static_cast<std::size_t>(std::sqrt(static_cast<double>(size)));
+        const std::size_t guard = std::max(__interpolation_cutoff / 2, 2 * deviation);
+        const double fraction = static_cast<double>(key - low_key) / static_cast<double>(high_key - low_key);
+        std::size_t pos = lo - 1 + static_cast<std::size_t>(fraction * static_cast<double>(size + 1));
+        pos = std::min(std::max(pos, lo), hi - 1);
+        ++stats.interpolation_probes;
+        std::size_t next = pos;
+        if (first[static_cast<__Difference>(pos)] < value) {
+            lo = pos + 1;
+            low_key = __order_key(first[static_cast<__Difference>(pos)]);
+            next = hi - pos > guard ? pos + guard : pos;
+        } else {
+            hi = pos;
+            high_key = __order_key(first[static_cast<__Difference>(pos)]);
+            next = pos - lo > guard ? pos - guard : pos;
+        }
+        if (next != pos) {
+            ++stats.interpolation_probes;
+            if (first[static_cast<__Difference>(next)] < value) {
+                lo = next + 1;
+                low_key = __order_key(first[static_cast<__Difference>(next)]);
+            } else {
+                hi = next;
+                high_key = __order_key(first[static_cast<__Difference>(next)]);
+            }
+        }
+        if (2 * (hi - lo) > size) {
+            ++stats.fallbacks;
+            return __bisect_within(first, n, lo, hi, value, stats);
+        }
+    }
+    for (std::size_t size = hi - lo; size > 0;) {
+        const std::size_t half = size / 2;
+        ++stats.binary_probes;
+        if (first[static_cast<__Difference>(lo + half)] < value) {
+            lo += half + 1;
+            size -= half + 1;
+        } else {
+            size = half;
+        }
+    }
+    return lo;
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Returns the first element in the sorted range [first, last) that is not less than value, found by
+ * interpolation search.
+ *
+ * <p>
+ * The elements are integers, each probe reads the element at the position where value would be if the elements were
+ * evenly spread between the ends of the remaining range, which takes O(log log n) probes on average for uniformly
+ * distributed keys. Each probe is followed by a second one a little further towards value, and the search
+ * switches to bisection when at most 16 elements remain, or as soon as a step removes less than half of the range,
+ * so that skewed distributions take O(log n) probes.
+ * </p>
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * The value type of RandomIt must meet the requirements of <i>stl_concept::Integral</i>.
+ * @param first, last - the sorted range of elements to examine
+ * @param value - the value to compare the elements to
+ * @return Iterator to the first element not less than value or last if no such element is found.
+ * @see https://en.cppreference.com/w/cpp/algorithm/lower_bound
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt>
+inline RandomIt lower_bound_interpolated(
+    RandomIt first,
+    RandomIt last,
+    const typename std::iterator_traits<RandomIt>::value_type& value);
+#else // DOXYGEN_WORKING
+template <class RandomIt>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((stl_concept::Integral<__detail::__iterator_value_t<RandomIt>>)),
+        // Return
+        (RandomIt)
+    )
+inline lower_bound_interpolated(RandomIt first, RandomIt last, const __detail::__iterator_value_t<RandomIt>& value)
+{
+    interpolation_statistics stats;
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    return first + static_cast<__detail::__iterator_difference_t<RandomIt>>(
+        __detail::__lower_bound_interpolated(first, n, value, stats));
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Returns the first element in the sorted range [first, last) that is not less than value, found by
+ * interpolation search, and adds its probes to stats.
+ * @param stats - statistics to which the probes of the search are added
+ * @see stl_algorithm::lower_bound_interpolated
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt>
+inline RandomIt lower_bound_interpolated(
+    RandomIt first,
+    RandomIt last,
+    const typename std::iterator_traits<RandomIt>::value_type& value,
+    interpolation_statistics& stats);
+#else // DOXYGEN_WORKING
+template <class RandomIt>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((stl_concept::Integral<__detail::__iterator_value_t<RandomIt>>)),
+        // Return
+        (RandomIt)
+    )
+inline lower_bound_interpolated(
+    RandomIt first,
+    RandomIt last,
+    const __detail::__iterator_value_t<RandomIt>& value,
+    interpolation_statistics& stats)
+{
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    return first + static_cast<__detail::__iterator_difference_t<RandomIt>>(
+        __detail::__lower_bound_interpolated(first, n, value, stats));
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_LOWER_BOUND_INTERPOLATED_HPP__
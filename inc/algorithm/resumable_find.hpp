@@ -0,0 +1,426 @@
+/** @file */
+#ifndef __STL_ALGORITHM_RESUMABLE_FIND_HPP__
+#define __STL_ALGORITHM_RESUMABLE_FIND_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/concept/requires.hpp>
+#include "concept/copy_constructible.hpp"
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_algorithm {
+
+/**
+ * @brief State of stl_algorithm::find or find_if over a sequence which arrives in pieces.
+ *
+ * <p>
+ * Each call takes the piece following the elements consumed by the previous call, so the elements already examined
+ * are never examined again and the pieces already examined may be discarded.
+ * </p>
+ */
+class find_state
+{
+public:
+    /** @brief Constructs the state of a search which has not consumed any element. */
+    find_state()
+        : offset_(0)
+        , match_(0)
+    {}
+
+    /** @brief Returns the number of elements consumed, which is the index of the first element of the next piece. */
+    std::size_t offset() const
+    {
+        return offset_;
+    }
+
+    /** @brief Returns the index in the sequence of the element found by the last successful call. */
+    std::size_t match() const
+    {
+        return match_;
+    }
+
+    /// @cond DEV
+    /** @brief Consumes n elements which do not satisfy the search. */
+    void __skip(std::size_t n)
+    {
+        offset_ += n;
+    }
+
+    /** @brief Consumes the element found. */
+    void __found()
+    {
+        match_ = offset_++;
+    }
+    /// @endcond
+
+private:
+    std::size_t offset_;
+    std::size_t match_;
+};
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Predicate which returns x == value. */
+template <class T>
+struct __equal_to_ref
+{
+    const T& value;
+
+    template <class U>
+    bool operator()(U&& x) const
+    {
+        return x == value;
+    }
+};
+
+template <class ForwardIt, class UnaryPredicate>
+inline ForwardIt __find_if_resume(
+    ForwardIt first,
+    ForwardIt last,
+    UnaryPredicate& p,
+    find_state& state,
+    std::true_type)
+{
+    ForwardIt found = std::find_if(first, last, std::ref(p));
+    state.__skip(static_cast<std::size_t>(std::distance(first, found)));
+    if (found != last) {
+        state.__found();
+    }
+    return found;
+}
+
+template <class InputIt, class UnaryPredicate>
+inline InputIt __find_if_resume(
+    InputIt first,
+    InputIt last,
+    UnaryPredicate& p,
+    find_state& state,
+    std::false_type)
+{
+    for (; first != last; ++first) {
+        if (p(*first)) {
+            state.__found();
+            break;
+        }
+        state.__skip(1);
+    }
+    return first;
+}
+
+template <class Iterator>
+using __is_forward_iterator = std::is_base_of<std::forward_iterator_tag, __iterator_category_t<Iterator>>;
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::find for a sequence arriving in pieces.
+ *
+ * <p>
+ * Searches the piece [first, last) which follows the elements consumed by the previous calls with state. The found
+ * element is consumed, so that the next call with the following elements finds the next occurrence.
+ * </p>
+ * @param first, last - the piece of the sequence
+ * @param value - value to compare the elements to
+ * @param state - state carried from a call to the next, state.match() is the index of the found element
+ * @return Iterator to the first element satisfying the condition or last if no such element is found in the piece.
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class T>
+inline InputIt find(InputIt first, InputIt last, const T& value, find_state& state);
+#else // DOXYGEN_WORKING
+template <class InputIt, class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>))
+        ((stl_concept::EqualityComparableWith<__detail::__iterator_value_t<InputIt>, T>)),
+        // Return
+        (InputIt)
+    )
+inline find(InputIt first, InputIt last, const T& value, find_state& state)
+{
+    __detail::__equal_to_ref<T> p{value};
+    return __detail::__find_if_resume(first, last, p, state, __detail::__is_forward_iterator<InputIt>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if for a sequence arriving in pieces.
+ *
+ * <p>
+ * Searches the piece [first, last) which follows the elements consumed by the previous calls with state. The found
+ * element is consumed, so that the next call with the following elements finds the next occurrence.
+ * </p>
+ * @param first, last - the piece of the sequence
+ * @param p - unary predicate which returns true for the required element
+ * @param state - state carried from a call to the next, state.match() is the index of the found element
+ * @return Iterator to the first element satisfying the condition or last if no such element is found in the piece.
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class UnaryPredicate>
+inline InputIt find_if(InputIt first, InputIt last, UnaryPredicate p, find_state& state);
+#else // DOXYGEN_WORKING
+template <class InputIt, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, InputIt>)),
+        // Return
+        (InputIt)
+    )
+inline find_if(InputIt first, InputIt last, UnaryPredicate p, find_state& state)
+{
+    return __detail::__find_if_resume(first, last, p, state, __detail::__is_forward_iterator<InputIt>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief State of stl_algorithm::search for a pattern over a sequence which arrives in pieces.
+ *
+ * <p>
+ * It keeps a copy of the pattern and the length of the prefix of the pattern matched by the last elements consumed,
+ * so that an occurrence split between two pieces is found without keeping the previous piece. The pattern is
+ * matched with the Knuth-Morris-Pratt automaton, each element is examined a constant number of times on average.
+ * </p>
+ * @tparam T - element type of the pattern, must meet the requirements of <i>stl_concept::CopyConstructible</i>
+ */
+template <class T>
+class search_state
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyConstructible<T>));
+
+public:
+    /**
+     * @param s_first, s_last - the pattern to search for
+     */
+    template <class InputIt>
+    search_state(InputIt s_first, InputIt s_last)
+        : pattern_(s_first, s_last)
+        , failure_(pattern_.size(), 0)
+        , matched_(0)
+        , offset_(0)
+        , match_(0)
+    {
+        // failure_[i] is the length of the longest proper prefix of pattern_[0, i] which is also its suffix.
+        std::size_t k = 0;
+        for (std::size_t i = 1; i < pattern_.size(); ++i) {
+            while (k > 0 && !(pattern_[i] == pattern_[k])) {
+                k = failure_[k - 1];
+            }
+            if (pattern_[i] == pattern_[k]) {
+                ++k;
+            }
+            failure_[i] = k;
+        }
+    }
+
+    /** @brief Returns the number of elements consumed, which is the index of the first element of the next piece. */
+    std::size_t offset() const
+    {
+        return offset_;
+    }
+
+    /** @brief Returns the index in the sequence of the first element of the occurrence found by the last call. */
+    std::size_t match() const
+    {
+        return match_;
+    }
+
+    /** @brief Returns the number of elements of the pattern matched by the last elements consumed. */
+    std::size_t partial() const
+    {
+        return matched_;
+    }
+
+    /** @brief Returns the pattern. */
+    const std::vector<T>& pattern() const
+    {
+        return pattern_;
+    }
+
+    /// @cond DEV
+    /** @brief Consumes x, returns true if x completes an occurrence of the pattern. */
+    template <class U>
+    bool __consume(const U& x)
+    {
+        ++offset_;
+        while (matched_ > 0 && !(x == pattern_[matched_])) {
+            matched_ = failure_[matched_ - 1];
+        }
+        if (x == pattern_[matched_]) {
+            ++matched_;
+        }
+        if (matched_ == pattern_.size()) {
+            match_ = offset_ - matched_;
+            // Occurrences may overlap, the next one continues from the longest border of the pattern.
+            matched_ = failure_[matched_ - 1];
+            return true;
+        }
+        return false;
+    }
+
+    void __match_empty()
+    {
+        match_ = offset_;
+    }
+    /// @endcond
+
+private:
+    std::vector<T> pattern_;
+    std::vector<std::size_t> failure_;
+    std::size_t matched_;
+    std::size_t offset_;
+    std::size_t match_;
+};
+
+/**
+ * @brief Creates the search_state of the pattern [s_first, s_last).
+ */
+template <class InputIt>
+inline search_state<__detail::__iterator_value_t<InputIt>> make_search_state(InputIt s_first, InputIt s_last)
+{
+    return search_state<__detail::__iterator_value_t<InputIt>>(s_first, s_last);
+}
+
+/**
+ * @brief Searches for the next occurrence of the pattern of state in a sequence arriving in pieces.
+ *
+ * <p>
+ * Consumes the piece [first, last), which follows the elements consumed by the previous calls with state, until
+ * the end of an occurrence of the pattern. The occurrence may start in a previous piece, state.match() gives the
+ * index of its first element in the sequence. Occurrences may overlap.<br/>
+ * An empty pattern occurs at the beginning of every piece.
+ * </p>
+ * @tparam InputIt - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ * The dereferenced type of InputIt and T must meet the requirements of <i>stl_concept::EqualityComparableWith</i>.
+ * @param first, last - the piece of the sequence
+ * @param state - pattern and state carried from a call to the next
+ * @return Iterator past the last element of the occurrence or last if no occurrence ends in the piece.
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt, class T>
+inline InputIt search(InputIt first, InputIt last, search_state<T>& state);
+#else // DOXYGEN_WORKING
+template <class InputIt, class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt>))
+        ((stl_concept::EqualityComparableWith<__detail::__iterator_value_t<InputIt>, T>)),
+        // Return
+        (InputIt)
+    )
+inline search(InputIt first, InputIt last, search_state<T>& state)
+{
+    if (state.pattern().empty()) {
+        state.__match_empty();
+        return first;
+    }
+    while (first != last) {
+        if (state.__consume(*first++)) {
+            break;
+        }
+    }
+    return first;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief State of stl_algorithm::mismatch over two sequences which arrive in pieces.
+ */
+class mismatch_state
+{
+public:
+    /** @brief Constructs the state of a comparison which has not consumed any element. */
+    mismatch_state()
+        : offset_(0)
+        , mismatched_(false)
+    {}
+
+    /** @brief Returns the number of equal pairs of elements consumed, which is the index of the next pair. */
+    std::size_t offset() const
+    {
+        return offset_;
+    }
+
+    /** @brief Returns true if a mismatching pair was found, at the index offset(). */
+    bool mismatched() const
+    {
+        return mismatched_;
+    }
+
+    /// @cond DEV
+    /** @brief Consumes an equal pair. */
+    void __skip()
+    {
+        ++offset_;
+    }
+
+    /** @brief Records the mismatching pair at offset(). */
+    void __mismatch()
+    {
+        mismatched_ = true;
+    }
+    /// @endcond
+
+private:
+    std::size_t offset_;
+    bool mismatched_;
+};
+
+/**
+ * @brief Overload of stl_algorithm::mismatch for two sequences arriving in pieces.
+ *
+ * <p>
+ * Compares the pieces [first1, last1) and [first2, last2), which follow the elements consumed by the previous calls
+ * with state, until a mismatching pair or the end of the shorter piece. The elements left in the longer piece are
+ * passed again with the next piece of the other sequence. Once a mismatch is found, the calls consume nothing.
+ * </p>
+ * @param first1, last1 - the piece of the first sequence
+ * @param first2, last2 - the piece of the second sequence
+ * @param state - state carried from a call to the next
+ * @return std::pair with iterators to the mismatching pair, or to the first elements not compared in the pieces.
+ * @see stl_algorithm::mismatch
+ */
+#ifdef DOXYGEN_WORKING
+template <class InputIt1, class InputIt2>
+inline auto mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, mismatch_state& state)
+    -> decltype(std::pair<InputIt1, InputIt2>);
+#else // DOXYGEN_WORKING
+template <class InputIt1, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<InputIt1>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<__detail::__iterator_value_t<InputIt1>, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<InputIt1, InputIt2>)
+    )
+inline mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, mismatch_state& state)
+{
+    if (!state.mismatched()) {
+        for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+            if (!(*first1 == *first2)) {
+                state.__mismatch();
+                break;
+            }
+            state.__skip();
+        }
+    }
+    return std::make_pair(first1, first2);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ALGORITHM_RESUMABLE_FIND_HPP__
@@ -74,8 +74,8 @@ BOOST_concept(Compare, (Func)(First)(Second))
                 std::declval<Second&>(),
                 std::declval<First&>()));
 
-        BOOST_CONCETP_ASSERT((ConvertibleTo<__CompRet1, bool>));
-        BOOST_CONCETP_ASSERT((ConvertibleTo<__CompRet2, bool>));
+        BOOST_CONCEPT_ASSERT((ConvertibleTo<__CompRet1, bool>));
+        BOOST_CONCEPT_ASSERT((ConvertibleTo<__CompRet2, bool>));
 
         BOOST_CONCEPT_ASSERT((Same<
             decltype(!std::declval<__CompRet1>() && !std::declval<__CompRet2>()),
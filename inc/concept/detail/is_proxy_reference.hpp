@@ -0,0 +1,41 @@
+/** @file */
+#ifndef __STL_CONCEPT_DETAIL_IS_PROXY_REFERENCE_HPP__
+#define __STL_CONCEPT_DETAIL_IS_PROXY_REFERENCE_HPP__
+
+#include <type_traits>
+#include <utility>
+
+namespace stl_concept {
+namespace __detail {
+
+/// @cond DEV
+struct __is_proxy_reference_impl
+{
+    template <class R, class T>
+    static auto __test(int) -> decltype(std::declval<R>() = std::declval<const T&>(), std::true_type());
+    template <class R, class T>
+    static std::false_type __test(...);
+};
+
+/**
+ * @struct __is_proxy_reference
+ * @brief Check if type R is a proxy reference to T, such as std::vector<bool>::reference: a class type which is
+ *        convertible to T and assignable from T.
+ * @tparam R - reference type of an iterator
+ * @tparam T - value type of the iterator
+ */
+template <class R, class T>
+struct __is_proxy_reference
+    : std::integral_constant<
+        bool,
+        std::is_class<typename std::remove_reference<R>::type>::value &&
+        std::is_convertible<R, T>::value &&
+        decltype(__is_proxy_reference_impl::__test<R, T>(0))::value
+    >
+{};
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_concept
+
+#endif  // __STL_CONCEPT_DETAIL_IS_PROXY_REFERENCE_HPP__
@@ -0,0 +1,85 @@
+/** @file */
+#ifndef __STL_CONCEPT_HASHABLE_HPP__
+#define __STL_CONCEPT_HASHABLE_HPP__
+
+#include "concept/convertible_to.hpp"
+#include "concept/copy_constructible.hpp"
+#include "concept/default_constructible.hpp"
+#include "concept/equality_comparable.hpp"
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/usage.hpp>
+#include <boost/concept/detail/concept_def.hpp>
+#include "concept/detail/remove_cvref.hpp"
+
+#if (defined _MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4197) // topmost volatile ignored
+#pragma warning(disable : 4510) // default constructor could not be generated
+#pragma warning(disable : 4610) // object 'class' can never be instantiated - user-defined constructor required
+#endif
+
+namespace stl_concept {
+
+/**
+ * @addtogroup library_wide_group Library-wide Requirements
+ * @struct Hashable
+ * @brief Specifies that an instance of the type can be hashed by std::hash and compared with == operator, so that it
+ * can be the key of an unordered container with the default hash function.
+ *
+ * <p>
+ * <b>Requirements</b>
+ * </p><p>
+ * The type T satisfies <i>Hashable</i> if
+ * <ul style="list-style-type:disc">
+ *   <li>The type T satisfies <i>EqualityComparable</i></li>
+ *   <li>The specialization std::hash<Key>, where Key is T without reference and cv-qualifiers, satisfies
+ *       <i>DefaultConstructible</i> and <i>CopyConstructible</i></li>
+ * </ul>
+ * And, given
+ * <ul style="list-style-type:disc">
+ *   <li>h, a value of type const std::hash<Key></li>
+ *   <li>k, a value of type const Key</li>
+ * </ul>
+ * The following expressions must be valid and have their specified effects
+ * <table>
+ *   <tr><th>Expression<th>Return type <th>Requirements
+ *   <tr><td>h(k)      <td>std::size_t <td>For two keys k1 and k2 that are equal, h(k1) == h(k2).
+ * </table>
+ * </p>
+ * @tparam T - type to be checked
+ * @see https://en.cppreference.com/w/cpp/named_req/Hash
+ * @see https://en.cppreference.com/w/cpp/utility/hash
+ */
+#ifdef DOXYGEN_WORKING
+template <typename T>
+struct Hashable
+    : EqualityComparable<T> {};
+#else // DOXYGEN_WORKING
+BOOST_concept(Hashable, (T))
+    : EqualityComparable<T>
+{
+    BOOST_CONCEPT_ASSERT((DefaultConstructible<std::hash<__detail::__remove_cvref_t<T>>>));
+    BOOST_CONCEPT_ASSERT((CopyConstructible<std::hash<__detail::__remove_cvref_t<T>>>));
+
+    BOOST_CONCEPT_USAGE(Hashable)
+    {
+        BOOST_CONCEPT_ASSERT((ConvertibleTo<
+            decltype(std::declval<const std::hash<__detail::__remove_cvref_t<T>>&>()(
+                std::declval<const __detail::__remove_cvref_t<T>&>())),
+            std::size_t>));
+    }
+};
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_concept
+
+#if (defined _MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include <boost/concept/detail/concept_undef.hpp>
+
+#endif  // __STL_CONCEPT_HASHABLE_HPP__
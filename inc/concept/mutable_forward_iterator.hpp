@@ -6,9 +6,11 @@
 #include "concept/derived_from.hpp"
 #include "concept/forward_iterator.hpp"
 #include "concept/output_iterator.hpp"
+#include <type_traits>
 #include <boost/concept/assert.hpp>
 #include <boost/concept/usage.hpp>
 #include <boost/concept/detail/concept_def.hpp>
+#include "concept/detail/is_proxy_reference.hpp"
 #include "concept/detail/iterator_traits.hpp"
 
 #if (defined _MSC_VER)
@@ -34,7 +36,8 @@ namespace stl_concept {
  *   <li>The type It satisfies <i>ForwardIterator</i></li>
  *   <li>The type It satisfies <i>OutputIterator</i></li>
  *   <li>The type boost::iterator_reference<It>::type must be exactly T&, where T is the type denoted by
- *       boost::iterator_value<It>::type</li>
+ *       boost::iterator_value<It>::type, or a proxy class convertible to T and assignable from T, such as
+ *       std::vector<bool>::reference</li>
  * </ul>
  * </p>
  * @tparam It - type to be checked
@@ -54,7 +57,10 @@ BOOST_concept(MutableForwardIterator, (It))
     {
         using __ValueType = __detail::__iterator_value_t<It>;
         using __ReferenceType = __detail::__iterator_reference_t<It>;
-        BOOST_CONCEPT_ASSERT((Same<__ReferenceType, __ValueType&>));
+        static_assert(
+            std::is_same<__ReferenceType, __ValueType&>::value ||
+            __detail::__is_proxy_reference<__ReferenceType, __ValueType>::value,
+            "reference must be value_type& or a proxy reference to value_type");
     }
 };
 #endif // DOXYGEN_WORKING
@@ -90,7 +90,8 @@ BOOST_concept(NullablePointer, (T))
         BOOST_CONCEPT_ASSERT((ConvertibleTo<decltype(p != nullptr), bool>));
         BOOST_CONCEPT_ASSERT((ConvertibleTo<decltype(nullptr != p), bool>));
 
-        __detail::__unuse(p = nullptr);
+        p = nullptr;
+        __detail::__unuse(p);
         BOOST_CONCEPT_ASSERT((Same<decltype(p = nullptr), T&>));
     }
 };
@@ -0,0 +1,443 @@
+/** @file */
+#ifndef __STL_INDEX_COUNTED_VECTOR_HPP__
+#define __STL_INDEX_COUNTED_VECTOR_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/copy_insertable.hpp"
+#include "concept/equality_comparable_with.hpp"
+#include "concept/erasable.hpp"
+#include "concept/input_iterator.hpp"
+#include "index/detail/container_iterator.hpp"
+
+namespace stl_index {
+
+/// @cond DEV
+namespace __detail {
+
+struct __counted_vector_tag
+{};
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Random access iterator over the elements of a counted_vector.
+ *
+ * The elements are constant, so that the frequency index stays exact, and stl_algorithm::count over the whole
+ * container is answered by the index.
+ * @tparam Container - counted_vector type
+ */
+template <class Container>
+using counted_vector_iterator = __detail::__const_container_iterator<Container, __detail::__counted_vector_tag>;
+
+/**
+ * @brief Sequence container which keeps the frequency of each value up to date, so that counting a value is O(1).
+ *
+ * <p>
+ * It stores the elements in a std::vector and a hash map from each value to its number of occurrences, which is
+ * updated by every modifier. Elements are not assignable through references or iterators, they are changed with
+ * replace().<br/>
+ * stl_algorithm::count over [begin(), end()) and count(value) read the map instead of scanning. The map costs a hash
+ * lookup on each modification, the benchmark count_index_benchmark shows from which ratio of counts to
+ * modifications it pays off.
+ * </p>
+ * @tparam T - value type, must meet the requirements of <i>stl_concept::CopyInsertable</i> and
+ * <i>stl_concept::Erasable</i>
+ * @tparam Hash - hash function of the values
+ * @tparam KeyEqual - equality of the values, consistent with operator== used by the algorithms
+ * @tparam Allocator - allocator of the elements
+ */
+template <class T, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, class Allocator = std::allocator<T>>
+class counted_vector
+{
+public:
+    using base_type = std::vector<T, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = typename base_type::size_type;
+    using difference_type = typename base_type::difference_type;
+    using reference = const T&;
+    using const_reference = const T&;
+    using pointer = typename base_type::const_pointer;
+    using const_pointer = typename base_type::const_pointer;
+    using const_iterator = counted_vector_iterator<counted_vector>;
+    using iterator = const_iterator;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyInsertable<T, base_type>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Erasable<T, base_type>));
+
+    using __FrequencyAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const T, size_type>>;
+    using __FrequencyMap = std::unordered_map<T, size_type, Hash, KeyEqual, __FrequencyAllocator>;
+
+public:
+    counted_vector() = default;
+
+    explicit counted_vector(const Allocator& alloc)
+        : elements_(alloc)
+        , frequencies_(0, Hash(), KeyEqual(), __FrequencyAllocator(alloc))
+    {}
+
+    template <class InputIt>
+    counted_vector(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : counted_vector(alloc)
+    {
+        assign(first, last);
+    }
+
+    counted_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator())
+        : counted_vector(init.begin(), init.end(), alloc)
+    {}
+
+    counted_vector(size_type n, const T& value, const Allocator& alloc = Allocator())
+        : counted_vector(alloc)
+    {
+        assign(n, value);
+    }
+
+    /** @brief Returns the number of elements equal to value, in constant time on average. */
+    size_type count(const T& value) const
+    {
+        auto found = frequencies_.find(value);
+        return found == frequencies_.end() ? 0 : found->second;
+    }
+
+    /** @brief Returns the number of distinct values. */
+    size_type distinct() const
+    {
+        return frequencies_.size();
+    }
+
+    /** @brief Returns the underlying vector. */
+    const base_type& base() const
+    {
+        return elements_;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return elements_.get_allocator();
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, elements_.begin());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, elements_.end());
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    size_type size() const
+    {
+        return elements_.size();
+    }
+
+    bool empty() const
+    {
+        return elements_.empty();
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        return elements_[pos];
+    }
+
+    const_reference at(size_type pos) const
+    {
+        return elements_.at(pos);
+    }
+
+    const_reference front() const
+    {
+        return elements_.front();
+    }
+
+    const_reference back() const
+    {
+        return elements_.back();
+    }
+
+    const_pointer data() const
+    {
+        return elements_.data();
+    }
+
+    void reserve(size_type n)
+    {
+        elements_.reserve(n);
+        frequencies_.reserve(n);
+    }
+
+    /** @brief Replaces the element at pos with value. */
+    void replace(const_iterator pos, const T& value)
+    {
+        const size_type i = static_cast<size_type>(pos - begin());
+        if (KeyEqual()(elements_[i], value)) {
+            return;
+        }
+        add(value);
+        auto old = frequencies_.find(elements_[i]);
+        try {
+            elements_[i] = value;
+        } catch (...) {
+            remove(value);
+            throw;
+        }
+        if (--old->second == 0) {
+            frequencies_.erase(old);
+        }
+    }
+
+    void push_back(const T& value)
+    {
+        elements_.push_back(value);
+        add_or_pop_back();
+    }
+
+    void push_back(T&& value)
+    {
+        elements_.push_back(std::move(value));
+        add_or_pop_back();
+    }
+
+    template <class... Args>
+    void emplace_back(Args&&... args)
+    {
+        elements_.emplace_back(std::forward<Args>(args)...);
+        add_or_pop_back();
+    }
+
+    void pop_back()
+    {
+        remove(elements_.back());
+        elements_.pop_back();
+    }
+
+    const_iterator insert(const_iterator pos, const T& value)
+    {
+        auto it = elements_.insert(pos.base(), value);
+        try {
+            add(*it);
+        } catch (...) {
+            elements_.erase(it);
+            throw;
+        }
+        return const_iterator(this, it);
+    }
+
+    template <class InputIt>
+    const_iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const difference_type offset = pos - begin();
+        const size_type old_size = elements_.size();
+        elements_.insert(elements_.begin() + offset, first, last);
+        const size_type n = elements_.size() - old_size;
+        try {
+            for (size_type i = 0; i < n; ++i) {
+                add(elements_[static_cast<size_type>(offset) + i]);
+            }
+        } catch (...) {
+            rebuild();
+            throw;
+        }
+        return begin() + offset;
+    }
+
+    const_iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    const_iterator erase(const_iterator first, const_iterator last)
+    {
+        const difference_type offset = first - begin();
+        for (auto it = first.base(); it != last.base(); ++it) {
+            remove(*it);
+        }
+        elements_.erase(first.base(), last.base());
+        return begin() + offset;
+    }
+
+    template <class InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    void assign(size_type n, const T& value)
+    {
+        clear();
+        elements_.assign(n, value);
+        if (n > 0) {
+            frequencies_.emplace(value, n);
+        }
+    }
+
+    void clear()
+    {
+        elements_.clear();
+        frequencies_.clear();
+    }
+
+    void swap(counted_vector& other)
+    {
+        elements_.swap(other.elements_);
+        frequencies_.swap(other.frequencies_);
+    }
+
+    friend bool operator==(const counted_vector& lhs, const counted_vector& rhs)
+    {
+        return lhs.elements_ == rhs.elements_;
+    }
+
+    friend bool operator!=(const counted_vector& lhs, const counted_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    void add(const T& value)
+    {
+        ++frequencies_[value];
+    }
+
+    void remove(const T& value)
+    {
+        auto found = frequencies_.find(value);
+        if (--found->second == 0) {
+            frequencies_.erase(found);
+        }
+    }
+
+    /** @brief Counts the last element, removes it if the map cannot be updated. */
+    void add_or_pop_back()
+    {
+        try {
+            add(elements_.back());
+        } catch (...) {
+            elements_.pop_back();
+            throw;
+        }
+    }
+
+    void rebuild()
+    {
+        frequencies_.clear();
+        for (const T& value : elements_) {
+            add(value);
+        }
+    }
+
+    base_type elements_;
+    __FrequencyMap frequencies_;
+};
+
+template <class T, class Hash, class KeyEqual, class Allocator>
+inline void swap(counted_vector<T, Hash, KeyEqual, Allocator>& lhs, counted_vector<T, Hash, KeyEqual, Allocator>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stl_index
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+template <class Container, class U>
+inline typename Container::difference_type __counted_vector_count(
+    stl_index::counted_vector_iterator<Container> first,
+    stl_index::counted_vector_iterator<Container> last,
+    const U& value,
+    std::true_type)
+{
+    const Container* container = first.container();
+    if (container != nullptr && first == container->begin() && last == container->end()) {
+        return static_cast<typename Container::difference_type>(container->count(value));
+    }
+    return std::count(first.base(), last.base(), value);
+}
+
+template <class Container, class U>
+inline typename Container::difference_type __counted_vector_count(
+    stl_index::counted_vector_iterator<Container> first,
+    stl_index::counted_vector_iterator<Container> last,
+    const U& value,
+    std::false_type)
+{
+    return std::count(first.base(), last.base(), value);
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::count for counted_vector ranges.
+ *
+ * <p>
+ * Counting a value of the element type over the whole container reads the frequency index in constant time, other
+ * ranges and values of other types are scanned.
+ * </p>
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class Container, class U>
+inline typename Container::difference_type count(
+    stl_index::counted_vector_iterator<Container> first,
+    stl_index::counted_vector_iterator<Container> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class Container, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::counted_vector_iterator<Container>>))
+        ((stl_concept::EqualityComparableWith<typename Container::value_type, U>)),
+        // Return
+        (typename Container::difference_type)
+    )
+inline count(
+    stl_index::counted_vector_iterator<Container> first,
+    stl_index::counted_vector_iterator<Container> last,
+    const U& value)
+{
+    return __detail::__counted_vector_count(first, last, value,
+        std::is_same<typename Container::value_type, U>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_INDEX_COUNTED_VECTOR_HPP__
@@ -0,0 +1,170 @@
+/** @file */
+#ifndef __STL_INDEX_DETAIL_CONTAINER_ITERATOR_HPP__
+#define __STL_INDEX_DETAIL_CONTAINER_ITERATOR_HPP__
+
+#include <iterator>
+#include <memory>
+
+namespace stl_index {
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Constant random access iterator over the elements of a container which wraps a random access container.
+ *
+ * <p>
+ * It is constant, since assigning an element through it would bypass what the container maintains beside its
+ * elements, and it knows its container so that the algorithms can read that. An iterator created by an algorithm from
+ * iterators of the wrapped container has no container.
+ * </p>
+ * @tparam Container - container type, whose wrapped container type is Container::base_type
+ * @tparam Tag - type which tells the kinds of containers apart, so that the overloads of the algorithms for the
+ * iterators of one kind do not match those of another
+ */
+template <class Container, class Tag>
+class __const_container_iterator
+{
+    using __BaseIterator = typename Container::base_type::const_iterator;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Container::value_type;
+    using reference = typename std::iterator_traits<__BaseIterator>::reference;
+    using pointer = typename std::iterator_traits<__BaseIterator>::pointer;
+    using difference_type = typename Container::difference_type;
+
+    __const_container_iterator()
+        : container_(nullptr)
+        , it_()
+    {}
+
+    __const_container_iterator(const Container* container, __BaseIterator it)
+        : container_(container)
+        , it_(it)
+    {}
+
+    /** @brief Returns the iterator of the wrapped container. */
+    __BaseIterator base() const
+    {
+        return it_;
+    }
+
+    /** @brief Returns the container of the element, nullptr if it is unknown. */
+    const Container* container() const
+    {
+        return container_;
+    }
+
+    reference operator*() const
+    {
+        return *it_;
+    }
+
+    pointer operator->() const
+    {
+        return std::addressof(*it_);
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return it_[n];
+    }
+
+    __const_container_iterator& operator++()
+    {
+        ++it_;
+        return *this;
+    }
+
+    __const_container_iterator operator++(int)
+    {
+        __const_container_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    __const_container_iterator& operator--()
+    {
+        --it_;
+        return *this;
+    }
+
+    __const_container_iterator operator--(int)
+    {
+        __const_container_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    __const_container_iterator& operator+=(difference_type n)
+    {
+        it_ += n;
+        return *this;
+    }
+
+    __const_container_iterator& operator-=(difference_type n)
+    {
+        it_ -= n;
+        return *this;
+    }
+
+    friend __const_container_iterator operator+(__const_container_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend __const_container_iterator operator+(difference_type n, __const_container_iterator it)
+    {
+        return it += n;
+    }
+
+    friend __const_container_iterator operator-(__const_container_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return lhs.it_ - rhs.it_;
+    }
+
+    friend bool operator==(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    friend bool operator!=(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return lhs.it_ < rhs.it_;
+    }
+
+    friend bool operator>(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const __const_container_iterator& lhs, const __const_container_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    const Container* container_;
+    __BaseIterator it_;
+};
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_index
+
+#endif  // __STL_INDEX_DETAIL_CONTAINER_ITERATOR_HPP__
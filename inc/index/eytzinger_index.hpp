@@ -0,0 +1,225 @@
+/** @file */
+#ifndef __STL_INDEX_EYTZINGER_INDEX_HPP__
+#define __STL_INDEX_EYTZINGER_INDEX_HPP__
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/compare.hpp"
+#include "concept/copy_constructible.hpp"
+#include "concept/less_than_comparable.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/detail/bit_ops.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/sorted_search.hpp"
+
+namespace stl_index {
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Asks the processor to load the cache line of p, if the compiler supports it. */
+inline void __prefetch(const void* p)
+{
+#if (defined __GNUC__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Static search structure over a sorted random access range, which stores a copy of its elements in Eytzinger
+ * order.
+ *
+ * <p>
+ * The element at position 1 is the middle of the range, and the children of the element at position k are at 2k and
+ * 2k + 1, as in a binary heap, so that the first levels of the search share a few cache lines. lower_bound(value)
+ * descends without branches, the next position being 2k plus the result of the comparison, and prefetches the
+ * elements 4 levels below the current one, which are contiguous. The position of the result in the sorted range is
+ * computed from k in O(1), so that nothing but the copy of the elements is stored.<br/>
+ * The index answers like std::lower_bound over the range, which must not be modified while the index is used.
+ * </p>
+ * ```
+ * auto index = stl_index::make_eytzinger_index(ids.begin(), ids.end());
+ * auto it = index.find(id);
+ * ```
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * @tparam Compare - must meet the requirements of <i>stl_concept::Compare</i> for the value type of RandomIt.
+ */
+template <class RandomIt, class Compare = stl_algorithm::__detail::__less>
+class eytzinger_index
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<RandomIt>));
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyConstructible<stl_algorithm::__detail::__iterator_value_t<RandomIt>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Compare<
+        Compare,
+        stl_algorithm::__detail::__iterator_value_t<RandomIt>,
+        stl_algorithm::__detail::__iterator_value_t<RandomIt>>));
+
+public:
+    using iterator = RandomIt;
+    using value_type = stl_algorithm::__detail::__iterator_value_t<RandomIt>;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+
+    /**
+     * @brief Builds the index of [first, last), which must be sorted with respect to comp and stay valid and unmodified
+     * as long as the index is used. Sortedness is checked in debug builds, when NDEBUG is not defined.
+     */
+    eytzinger_index(RandomIt first, RandomIt last, const Compare& comp = Compare())
+        : first_(first)
+        , size_(static_cast<size_type>(last - first))
+        , levels_(stl_algorithm::__detail::__bit_width(size_))
+        , comp_(comp)
+    {
+        assert(std::is_sorted(first, last, comp_) && "stl_index::eytzinger_index: the range is not sorted");
+        values_.reserve(size_ + 1);
+        if (size_ > 0) {
+            // Position 0 is not used, it holds a copy of the first element.
+            values_.push_back(first[0]);
+        }
+        for (size_type k = 1; k <= size_; ++k) {
+            values_.push_back(first[static_cast<std::ptrdiff_t>(position(k))]);
+        }
+    }
+
+    /** @brief Returns the beginning of the indexed range. */
+    RandomIt begin() const
+    {
+        return first_;
+    }
+
+    /** @brief Returns the end of the indexed range. */
+    RandomIt end() const
+    {
+        return first_ + static_cast<std::ptrdiff_t>(size_);
+    }
+
+    /** @brief Returns the number of indexed elements. */
+    size_type size() const
+    {
+        return size_;
+    }
+
+    /** @brief Returns the number of elements ordered before value, which is the position of lower_bound(value). */
+    template <class T>
+    size_type rank(const T& value) const
+    {
+        const value_type* values = values_.data();
+        std::uint64_t k = 1;
+        while (k <= size_) {
+            __detail::__prefetch(values + std::min<std::uint64_t>(k * prefetch_stride, size_));
+            k = 2 * k + static_cast<std::uint64_t>(static_cast<bool>(comp_(values[k], value)));
+        }
+        // The last turn to the left is the lower bound, there is none if the descent only turned to the right.
+        k >>= stl_algorithm::__detail::__countr_zero(~k) + 1;
+        return k == 0 ? size_ : position(static_cast<size_type>(k));
+    }
+
+    /** @brief Returns the iterator to the first element which is not ordered before value, like std::lower_bound. */
+    template <class T>
+    RandomIt lower_bound(const T& value) const
+    {
+        return first_ + static_cast<std::ptrdiff_t>(rank(value));
+    }
+
+    /** @brief Returns the iterator to the first element equivalent to value, end() if there is none. */
+    template <class T>
+    RandomIt find(const T& value) const
+    {
+        const RandomIt it = lower_bound(value);
+        return it != end() && !comp_(value, *it) ? it : end();
+    }
+
+    /** @brief Returns the number of bytes used by the index. */
+    size_type memory_usage() const
+    {
+        return sizeof(*this) + values_.capacity() * sizeof(value_type);
+    }
+
+private:
+    /** @brief Distance between position k and its first descendant 4 levels below. */
+    static constexpr std::uint64_t prefetch_stride = 16;
+
+    /**
+     * @brief Returns the position in the sorted range of the element at position k in Eytzinger order.
+     *
+     * In a perfect tree of the same height, the element at depth d is preceded by (2 (k - 2^d) + 1) 2^(h - 1 - d) - 1
+     * elements. Half of them, rounded up, are in the last level, where only the leftmost elements exist.
+     */
+    size_type position(size_type k) const
+    {
+        const unsigned depth = stl_algorithm::__detail::__bit_width(k) - 1;
+        const size_type first_leaf = size_type(1) << (levels_ - 1);
+        const size_type perfect = ((2 * (k - (size_type(1) << depth)) + 1) << (levels_ - 1 - depth)) - 1;
+        const size_type leaves = (perfect + 1) / 2;
+        return perfect - leaves + std::min(leaves, size_ - first_leaf + 1);
+    }
+
+    RandomIt first_;
+    size_type size_;
+    unsigned levels_;
+    Compare comp_;
+    std::vector<value_type> values_;
+};
+
+/**
+ * @brief Creates an eytzinger_index of [first, last), sorted with respect to < operator.
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * The value type of RandomIt must meet the requirements of <i>stl_concept::LessThanComparable</i>.
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt>
+inline eytzinger_index<RandomIt> make_eytzinger_index(RandomIt first, RandomIt last);
+#else // DOXYGEN_WORKING
+template <class RandomIt>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((stl_concept::LessThanComparable<stl_algorithm::__detail::__iterator_value_t<RandomIt>>)),
+        // Return
+        (eytzinger_index<RandomIt>)
+    )
+inline make_eytzinger_index(RandomIt first, RandomIt last)
+{
+    return eytzinger_index<RandomIt>(first, last);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Creates an eytzinger_index of [first, last), sorted with respect to comp.
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * @tparam Compare - must meet the requirements of <i>stl_concept::Compare</i> for the value type of RandomIt.
+ */
+#ifdef DOXYGEN_WORKING
+template <class RandomIt, class Compare>
+inline eytzinger_index<RandomIt, Compare> make_eytzinger_index(RandomIt first, RandomIt last, Compare comp);
+#else // DOXYGEN_WORKING
+template <class RandomIt, class Compare>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::RandomAccessIterator<RandomIt>))
+        ((stl_concept::Compare<
+            Compare,
+            stl_algorithm::__detail::__iterator_value_t<RandomIt>,
+            stl_algorithm::__detail::__iterator_value_t<RandomIt>>)),
+        // Return
+        (eytzinger_index<RandomIt, Compare>)
+    )
+inline make_eytzinger_index(RandomIt first, RandomIt last, Compare comp)
+{
+    return eytzinger_index<RandomIt, Compare>(first, last, comp);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_index
+
+#endif  // __STL_INDEX_EYTZINGER_INDEX_HPP__
@@ -0,0 +1,322 @@
+/** @file */
+#ifndef __STL_INDEX_HASH_INDEX_HPP__
+#define __STL_INDEX_HASH_INDEX_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/forward_iterator.hpp"
+#include "concept/hashable.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+
+namespace stl_index {
+
+/**
+ * @brief Exception thrown when an index is used with a range which was rebuilt after the index was built.
+ */
+class stale_index : public std::logic_error
+{
+public:
+    explicit stale_index(const char* what)
+        : std::logic_error(what)
+    {}
+};
+
+/**
+ * @brief Counter of the modifications of a range, bumped by the owner of the range after each one.
+ *
+ * An index records the generation of the range it is built from, and throws stale_index when it is used after the
+ * generation changed. The generation must outlive the indexes built with it.
+ */
+class generation
+{
+public:
+    generation() noexcept
+        : value_(0)
+    {}
+
+    generation(const generation&) = delete;
+    generation& operator=(const generation&) = delete;
+
+    /** @brief Records a modification of the range. */
+    void bump() noexcept
+    {
+        ++value_;
+    }
+
+    /** @brief Returns the number of modifications recorded. */
+    std::size_t value() const noexcept
+    {
+        return value_;
+    }
+
+private:
+    std::size_t value_;
+};
+
+/**
+ * @brief Open addressing hash table from each value of a forward range to the iterator of its first occurrence.
+ *
+ * <p>
+ * The index is built once in O(n) and find(value) returns the same iterator as stl_algorithm::find over the range,
+ * in O(1) expected time. The table has a power of two number of slots, at least twice the number of elements, and is
+ * probed linearly. Each slot keeps the hash of its value, so that most collisions are rejected without dereferencing
+ * the iterator.<br/>
+ * The index is built with the stl_index::generation of the range, which the owner of the range bumps after each
+ * modification. A lookup after the generation changed throws stl_index::stale_index, as does a lookup with iterators
+ * which differ from the indexed ones, or which reaches an element whose hash is not the one it was indexed with.
+ * </p>
+ * ```
+ * stl_index::generation table_generation;
+ * auto index = stl_index::make_hash_index(table.begin(), table.end(), table_generation);
+ * auto it = stl_algorithm::find(table.begin(), table.end(), key, index);
+ * table.assign(rows.begin(), rows.end());
+ * table_generation.bump();
+ * index = stl_index::make_hash_index(table.begin(), table.end(), table_generation);
+ * ```
+ * @tparam ForwardIt - must meet the requirements of <i>stl_concept::ForwardIterator</i>.
+ * @tparam Hash - hash function of the values
+ * @tparam KeyEqual - equality of the values, consistent with operator== used by stl_algorithm::find
+ */
+template <
+    class ForwardIt,
+    class Hash = std::hash<stl_algorithm::__detail::__iterator_value_t<ForwardIt>>,
+    class KeyEqual = std::equal_to<stl_algorithm::__detail::__iterator_value_t<ForwardIt>>>
+class hash_index
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<ForwardIt>));
+
+public:
+    using iterator = ForwardIt;
+    using value_type = stl_algorithm::__detail::__iterator_value_t<ForwardIt>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    /**
+     * @brief Builds the index of [first, last), whose modifications are recorded by generation.
+     *
+     * The index is usable until generation is bumped.
+     */
+    hash_index(
+        ForwardIt first,
+        ForwardIt last,
+        const stl_index::generation& generation,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual())
+        : first_(first)
+        , last_(last)
+        , generation_(&generation)
+        , indexed_generation_(generation.value())
+        , size_(0)
+        , distinct_(0)
+        , hash_(hash)
+        , equal_(equal)
+    {
+        for (ForwardIt it = first; it != last; ++it) {
+            ++size_;
+        }
+        size_type capacity = 8;
+        while (capacity < 2 * size_) {
+            capacity *= 2;
+        }
+        slots_.resize(capacity);
+        for (; first != last; ++first) {
+            const size_type h = hash_(*first);
+            Slot* slot = probe(*first, h);
+            if (slot->empty()) {
+                slot->hash = h;
+                slot->it = first;
+                slot->used = true;
+                ++distinct_;
+            }
+        }
+    }
+
+    /** @brief Returns the beginning of the indexed range. */
+    ForwardIt begin() const
+    {
+        return first_;
+    }
+
+    /** @brief Returns the end of the indexed range. */
+    ForwardIt end() const
+    {
+        return last_;
+    }
+
+    /** @brief Returns the number of indexed elements. */
+    size_type size() const
+    {
+        return size_;
+    }
+
+    /** @brief Returns the number of distinct values. */
+    size_type distinct() const
+    {
+        return distinct_;
+    }
+
+    /** @brief Checks if [first, last) is the indexed range. */
+    bool indexes(ForwardIt first, ForwardIt last) const
+    {
+        return first == first_ && last == last_;
+    }
+
+    /** @brief Checks if the range was not modified since the index was built, according to its generation. */
+    bool current() const noexcept
+    {
+        return generation_->value() == indexed_generation_;
+    }
+
+    /**
+     * @brief Returns the iterator to the first element equal to value, end() if there is none.
+     * @throw stale_index if the generation of the range was bumped since the index was built, or if the lookup reaches
+     * an element which was modified since
+     */
+    template <class T>
+    ForwardIt find(const T& value) const
+    {
+        if (!current()) {
+            throw stale_index("stl_index::hash_index: the indexed range was modified");
+        }
+        const Slot* slot = probe(value, hash_(value));
+        return slot->empty() ? last_ : slot->it;
+    }
+
+private:
+    struct Slot
+    {
+        Slot()
+            : hash(0)
+            , it()
+            , used(false)
+        {}
+
+        bool empty() const
+        {
+            return !used;
+        }
+
+        size_type hash;
+        ForwardIt it;
+        bool used;
+    };
+
+    template <class T>
+    Slot* probe(const T& value, size_type h)
+    {
+        return const_cast<Slot*>(static_cast<const hash_index&>(*this).probe(value, h));
+    }
+
+    template <class T>
+    const Slot* probe(const T& value, size_type h) const
+    {
+        const size_type mask = slots_.size() - 1;
+        for (size_type i = h & mask;; i = (i + 1) & mask) {
+            const Slot& slot = slots_[i];
+            if (slot.empty()) {
+                return &slot;
+            }
+            if (slot.hash == h) {
+                if (equal_(*slot.it, value)) {
+                    return &slot;
+                }
+                if (hash_(*slot.it) != h) {
+                    throw stale_index("stl_index::hash_index: the indexed range was modified");
+                }
+            }
+        }
+    }
+
+    ForwardIt first_;
+    ForwardIt last_;
+    const stl_index::generation* generation_;
+    size_type indexed_generation_;
+    size_type size_;
+    size_type distinct_;
+    Hash hash_;
+    KeyEqual equal_;
+    std::vector<Slot> slots_;
+};
+
+/**
+ * @brief Creates a hash_index of [first, last) with std::hash and std::equal_to.
+ * @param generation - generation of the range, bumped by its owner after each modification
+ * @tparam ForwardIt - must meet the requirements of <i>stl_concept::ForwardIterator</i>.
+ * The value type of ForwardIt must meet the requirements of <i>stl_concept::Hashable</i>.
+ */
+#ifdef DOXYGEN_WORKING
+template <class ForwardIt>
+inline hash_index<ForwardIt> make_hash_index(ForwardIt first, ForwardIt last, const generation& generation);
+#else // DOXYGEN_WORKING
+template <class ForwardIt>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::ForwardIterator<ForwardIt>))
+        ((stl_concept::Hashable<stl_algorithm::__detail::__iterator_value_t<ForwardIt>>)),
+        // Return
+        (hash_index<ForwardIt>)
+    )
+inline make_hash_index(ForwardIt first, ForwardIt last, const generation& generation)
+{
+    return hash_index<ForwardIt>(first, last, generation);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_index
+
+namespace stl_algorithm {
+
+/**
+ * @brief Overload of stl_algorithm::find answered by a hash_index of [first, last), in O(1) expected time.
+ *
+ * <p>
+ * It returns the same iterator as stl_algorithm::find(first, last, value). The value is hashed with the hash function
+ * of the index, so it must hash equal to the elements it is equal to. The element found by the index is confirmed with
+ * *it == value, since the hash function and the equality of the index may see the value converted to the value type,
+ * 1.5 as 1 for int elements.
+ * </p>
+ * @param index - hash_index built from [first, last)
+ * @throw stl_index::stale_index if [first, last) is not the indexed range, or if it was detected to be modified
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class ForwardIt, class T, class Hash, class KeyEqual>
+inline ForwardIt find(
+    ForwardIt first,
+    ForwardIt last,
+    const T& value,
+    const stl_index::hash_index<ForwardIt, Hash, KeyEqual>& index);
+#else // DOXYGEN_WORKING
+template <class ForwardIt, class T, class Hash, class KeyEqual>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::ForwardIterator<ForwardIt>))
+        ((stl_concept::EqualityComparableWith<__detail::__iterator_value_t<ForwardIt>, T>)),
+        // Return
+        (ForwardIt)
+    )
+inline find(
+    ForwardIt first,
+    ForwardIt last,
+    const T& value,
+    const stl_index::hash_index<ForwardIt, Hash, KeyEqual>& index)
+{
+    // The iterators of a modified range may be invalidated, so they are compared only if the generation is current.
+    if (index.current() && !index.indexes(first, last)) {
+        throw stl_index::stale_index("stl_algorithm::find: the range is not the one of the index");
+    }
+    const ForwardIt it = index.find(value);
+    return it == last || *it == value ? it : last;
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_INDEX_HASH_INDEX_HPP__
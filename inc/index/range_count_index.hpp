@@ -0,0 +1,151 @@
+/** @file */
+#ifndef __STL_INDEX_RANGE_COUNT_INDEX_HPP__
+#define __STL_INDEX_RANGE_COUNT_INDEX_HPP__
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_index {
+
+/**
+ * @brief Fenwick tree counting the elements of a random access range for which a predicate returns true, over any
+ * subrange [i, j).
+ *
+ * <p>
+ * The index is built once in O(n) and answers count(i, j), the result of stl_algorithm::count_if(first + i, first + j,
+ * p), in O(log n). After an element of the range is modified, update(i) evaluates the predicate on it again and
+ * updates the tree in O(log n). It stores one std::size_t per element.
+ * </p>
+ * ```
+ * auto index = stl_index::make_range_count_index(v.begin(), v.end(), is_valid);
+ * v[42] = value;
+ * index.update(42);
+ * auto n = index.count(10, 1000);
+ * ```
+ * @tparam RandomIt - must meet the requirements of <i>stl_concept::RandomAccessIterator</i>.
+ * @tparam UnaryPredicate - must meet the requirements of <i>stl_concept::UnaryPredicate</i>.
+ */
+template <class RandomIt, class UnaryPredicate>
+class range_count_index
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<RandomIt>));
+    BOOST_CONCEPT_ASSERT((stl_algorithm::__detail::__UnaryPredicateProxy<UnaryPredicate, RandomIt>));
+
+public:
+    using iterator = RandomIt;
+    using size_type = std::size_t;
+    using difference_type = stl_algorithm::__detail::__iterator_difference_t<RandomIt>;
+
+    /**
+     * @param first, last - the range of elements to index, which must stay valid as long as the index is used
+     * @param p - unary predicate which returns true for the counted elements
+     */
+    range_count_index(RandomIt first, RandomIt last, UnaryPredicate p)
+        : first_(first)
+        , p_(std::move(p))
+        , matched_(static_cast<size_type>(last - first))
+        , tree_(static_cast<size_type>(last - first) + 1)
+    {
+        for (size_type i = 0; i < matched_.size(); ++i) {
+            matched_[i] = evaluate(i);
+            tree_[i + 1] += matched_[i];
+            const size_type parent = (i + 1) + lowest_bit(i + 1);
+            if (parent < tree_.size()) {
+                tree_[parent] += tree_[i + 1];
+            }
+        }
+    }
+
+    /** @brief Returns the number of indexed elements. */
+    size_type size() const
+    {
+        return matched_.size();
+    }
+
+    /** @brief Returns the number of elements in [first + i, first + j) for which the predicate returns true. */
+    size_type count(size_type i, size_type j) const
+    {
+        if (i > j || j > size()) {
+            throw std::out_of_range("stl_index::range_count_index::count");
+        }
+        return prefix(j) - prefix(i);
+    }
+
+    /** @brief Returns the number of elements for which the predicate returns true. */
+    size_type count() const
+    {
+        return prefix(size());
+    }
+
+    /** @brief Returns whether the predicate returned true for the element at first + i when it was last evaluated. */
+    bool test(size_type i) const
+    {
+        return matched_.at(i);
+    }
+
+    /** @brief Evaluates the predicate on the element at first + i again, after it was modified. */
+    void update(size_type i)
+    {
+        if (i >= size()) {
+            throw std::out_of_range("stl_index::range_count_index::update");
+        }
+        const bool matched = evaluate(i);
+        if (matched == matched_[i]) {
+            return;
+        }
+        matched_[i] = matched;
+        for (size_type k = i + 1; k < tree_.size(); k += lowest_bit(k)) {
+            if (matched) {
+                ++tree_[k];
+            } else {
+                --tree_[k];
+            }
+        }
+    }
+
+private:
+    static size_type lowest_bit(size_type k)
+    {
+        return k & (~k + 1);
+    }
+
+    bool evaluate(size_type i)
+    {
+        return static_cast<bool>(p_(first_[static_cast<difference_type>(i)]));
+    }
+
+    /** @brief Returns the count over [first, first + j). */
+    size_type prefix(size_type j) const
+    {
+        size_type result = 0;
+        for (; j > 0; j -= lowest_bit(j)) {
+            result += tree_[j];
+        }
+        return result;
+    }
+
+    RandomIt first_;
+    UnaryPredicate p_;
+    std::vector<bool> matched_;
+    std::vector<size_type> tree_;
+};
+
+/** @brief Creates a range_count_index of [first, last) for predicate p, deducing the types. */
+template <class RandomIt, class UnaryPredicate>
+inline range_count_index<RandomIt, UnaryPredicate> make_range_count_index(
+    RandomIt first,
+    RandomIt last,
+    UnaryPredicate p)
+{
+    return range_count_index<RandomIt, UnaryPredicate>(first, last, std::move(p));
+}
+
+} // namespace stl_index
+
+#endif  // __STL_INDEX_RANGE_COUNT_INDEX_HPP__
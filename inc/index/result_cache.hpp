@@ -0,0 +1,512 @@
+/** @file */
+#ifndef __STL_INDEX_RESULT_CACHE_HPP__
+#define __STL_INDEX_RESULT_CACHE_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/input_iterator.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+#include "index/detail/container_iterator.hpp"
+
+namespace stl_index {
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Object whose address identifies the type T. */
+template <class T>
+struct __type_id
+{
+    static const char id;
+};
+
+template <class T>
+const char __type_id<T>::id = 0;
+
+/** @brief Returns an identifier which no other cached_range of the process has. */
+inline std::uint64_t __next_range_id()
+{
+    static std::atomic<std::uint64_t> next(0);
+    return ++next;
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Bounded cache of the results of algorithms, evicting the least recently used ones.
+ *
+ * <p>
+ * A result is an offset or a count, stored under a key made of the identity and the version of the range, the type of
+ * the predicate, the algorithm and the examined subrange. Since the version of a range changes with each modification,
+ * the results computed before are never returned again, they are evicted as they become the least recently used.
+ * <br/>
+ * The cache is shared by the cached_range objects it is given to. It is not thread-safe.
+ * </p>
+ */
+class result_cache
+{
+public:
+    using size_type = std::size_t;
+    using result_type = std::ptrdiff_t;
+
+    /** @brief Key of a result. */
+    struct key
+    {
+        /** @brief Identity of the range. */
+        std::uint64_t range;
+        /** @brief Version of the range. */
+        std::uint64_t version;
+        /** @brief Identity of the algorithm. */
+        const void* algorithm;
+        /** @brief Identity of the predicate type. */
+        const void* predicate;
+        /** @brief Offset of the first examined element. */
+        std::ptrdiff_t first;
+        /** @brief Offset past the last examined element. */
+        std::ptrdiff_t last;
+
+        friend bool operator==(const key& lhs, const key& rhs)
+        {
+            return lhs.range == rhs.range && lhs.version == rhs.version && lhs.algorithm == rhs.algorithm &&
+                lhs.predicate == rhs.predicate && lhs.first == rhs.first && lhs.last == rhs.last;
+        }
+    };
+
+    /** @brief Creates a cache which holds at most capacity results. */
+    explicit result_cache(size_type capacity)
+        : capacity_(capacity)
+        , hits_(0)
+        , misses_(0)
+    {
+        index_.reserve(capacity);
+    }
+
+    result_cache(const result_cache&) = delete;
+    result_cache& operator=(const result_cache&) = delete;
+
+    /**
+     * @brief Returns the result stored under k, or stores and returns the result of compute() if there is none.
+     *
+     * Nothing is stored if compute throws.
+     */
+    template <class Compute>
+    result_type get(const key& k, Compute compute)
+    {
+        auto found = index_.find(k);
+        if (found != index_.end()) {
+            ++hits_;
+            entries_.splice(entries_.begin(), entries_, found->second);
+            return found->second->second;
+        }
+        ++misses_;
+        const result_type result = compute();
+        if (capacity_ == 0) {
+            return result;
+        }
+        if (entries_.size() == capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        entries_.emplace_front(k, result);
+        try {
+            index_.emplace(k, entries_.begin());
+        } catch (...) {
+            entries_.pop_front();
+            throw;
+        }
+        return result;
+    }
+
+    /** @brief Returns the maximum number of stored results. */
+    size_type capacity() const
+    {
+        return capacity_;
+    }
+
+    /** @brief Returns the number of stored results. */
+    size_type size() const
+    {
+        return entries_.size();
+    }
+
+    /** @brief Returns the number of lookups which found their result. */
+    size_type hits() const
+    {
+        return hits_;
+    }
+
+    /** @brief Returns the number of lookups which computed their result. */
+    size_type misses() const
+    {
+        return misses_;
+    }
+
+    /** @brief Removes the stored results, the counters are kept. */
+    void clear()
+    {
+        index_.clear();
+        entries_.clear();
+    }
+
+private:
+    struct key_hash
+    {
+        std::size_t operator()(const key& k) const
+        {
+            std::size_t h = std::hash<std::uint64_t>()(k.range);
+            const std::size_t parts[] = {
+                std::hash<std::uint64_t>()(k.version),
+                std::hash<const void*>()(k.algorithm),
+                std::hash<const void*>()(k.predicate),
+                std::hash<std::ptrdiff_t>()(k.first),
+                std::hash<std::ptrdiff_t>()(k.last)};
+            for (std::size_t part : parts) {
+                h ^= part + 0x9e3779b9u + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+    };
+
+    using __Entries = std::list<std::pair<key, result_type>>;
+
+    size_type capacity_;
+    size_type hits_;
+    size_type misses_;
+    __Entries entries_;
+    std::unordered_map<key, typename __Entries::iterator, key_hash> index_;
+};
+
+/// @cond DEV
+namespace __detail {
+
+struct __cached_range_tag
+{};
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Random access iterator over the elements of a cached_range.
+ *
+ * The elements are constant, since a write through an iterator would not change the version of the range, and the
+ * algorithms look their results up in the cache of the range.
+ * @tparam Range - cached_range type
+ */
+template <class Range>
+using cached_range_iterator = __detail::__const_container_iterator<Range, __detail::__cached_range_tag>;
+
+/**
+ * @brief View of a random access container whose version changes with each modification, so that
+ * stl_algorithm::count_if and stl_algorithm::find_if over its iterators memoize their results in a result_cache.
+ *
+ * <p>
+ * The results are memoized for stateless predicates only, whose type is empty like a lambda without capture, since
+ * their result is then a function of the element. The results for other predicates are computed each time.<br/>
+ * The container is modified through the object returned by modify(), which changes the version of the range when it
+ * is destroyed, after the writes. Modifying the container otherwise leaves the results computed before in use.
+ * </p>
+ * ```
+ * stl_index::result_cache cache(1024);
+ * stl_index::cached_range<std::vector<Order>> orders(table, cache);
+ * auto pending = stl_algorithm::count_if(orders.begin(), orders.end(), [](const Order& o) { return o.pending; });
+ * orders.modify()->push_back(order);
+ * ```
+ * @tparam Container - container whose const_iterator meets the requirements of
+ * <i>stl_concept::RandomAccessIterator</i>
+ */
+template <class Container>
+class cached_range
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<typename Container::const_iterator>));
+
+public:
+    using base_type = Container;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using difference_type = typename Container::difference_type;
+    using const_iterator = cached_range_iterator<cached_range>;
+    using iterator = const_iterator;
+
+    /**
+     * @brief Access to the container of a cached_range, which changes the version of the range when it is destroyed.
+     *
+     * The results computed while it exists are not returned once it is destroyed, so the container can be modified
+     * through it or through references obtained from it until then.
+     */
+    class modification
+    {
+    public:
+        modification(modification&& other) noexcept
+            : range_(other.range_)
+        {
+            other.range_ = nullptr;
+        }
+
+        modification(const modification&) = delete;
+        modification& operator=(const modification&) = delete;
+
+        ~modification()
+        {
+            if (range_ != nullptr) {
+                ++range_->version_;
+            }
+        }
+
+        Container& operator*() const
+        {
+            return *range_->container_;
+        }
+
+        Container* operator->() const
+        {
+            return range_->container_;
+        }
+
+    private:
+        friend class cached_range;
+
+        explicit modification(cached_range* range)
+            : range_(range)
+        {}
+
+        cached_range* range_;
+    };
+
+    /** @brief Creates the view of container, which memoizes its results in cache. Both must outlive the view. */
+    cached_range(Container& container, result_cache& cache)
+        : container_(&container)
+        , cache_(&cache)
+        , id_(__detail::__next_range_id())
+        , version_(0)
+    {}
+
+    cached_range(const cached_range&) = delete;
+    cached_range& operator=(const cached_range&) = delete;
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, container_->cbegin());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, container_->cend());
+    }
+
+    size_type size() const
+    {
+        return container_->size();
+    }
+
+    bool empty() const
+    {
+        return container_->empty();
+    }
+
+    /** @brief Returns the container. */
+    const Container& base() const
+    {
+        return *container_;
+    }
+
+    /**
+     * @brief Returns the access to the container to be modified.
+     *
+     * The version of the range changes when the returned object is destroyed, at the end of the full expression in
+     * range.modify()->push_back(value).
+     */
+    modification modify()
+    {
+        return modification(this);
+    }
+
+    /** @brief Returns the identity of the range, unique in the process. */
+    std::uint64_t id() const
+    {
+        return id_;
+    }
+
+    /** @brief Returns the version of the range. */
+    std::uint64_t version() const
+    {
+        return version_;
+    }
+
+    /** @brief Returns the cache of the range. */
+    result_cache& cache() const
+    {
+        return *cache_;
+    }
+
+private:
+    Container* container_;
+    result_cache* cache_;
+    std::uint64_t id_;
+    std::uint64_t version_;
+};
+
+} // namespace stl_index
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+struct __cached_count_if_tag
+{};
+
+struct __cached_find_if_tag
+{};
+
+template <class Algorithm, class UnaryPredicate, class Range>
+inline stl_index::result_cache::key __cached_key(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last)
+{
+    const Range* range = first.container();
+    return stl_index::result_cache::key{
+        range->id(),
+        range->version(),
+        &stl_index::__detail::__type_id<Algorithm>::id,
+        &stl_index::__detail::__type_id<UnaryPredicate>::id,
+        first - range->begin(),
+        last - range->begin()};
+}
+
+template <class Range, class UnaryPredicate>
+inline typename Range::difference_type __cached_count_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate& p,
+    std::true_type)
+{
+    if (first.container() == nullptr) {
+        return std::count_if(first.base(), last.base(), p);
+    }
+    return static_cast<typename Range::difference_type>(first.container()->cache().get(
+        __cached_key<__cached_count_if_tag, UnaryPredicate>(first, last),
+        [&first, &last, &p]() { return std::count_if(first.base(), last.base(), p); }));
+}
+
+template <class Range, class UnaryPredicate>
+inline typename Range::difference_type __cached_count_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate& p,
+    std::false_type)
+{
+    return std::count_if(first.base(), last.base(), p);
+}
+
+template <class Range, class UnaryPredicate>
+inline stl_index::cached_range_iterator<Range> __cached_find_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate& p,
+    std::true_type)
+{
+    if (first.container() == nullptr) {
+        return stl_index::cached_range_iterator<Range>(nullptr, std::find_if(first.base(), last.base(), p));
+    }
+    const Range* range = first.container();
+    const auto offset = range->cache().get(
+        __cached_key<__cached_find_if_tag, UnaryPredicate>(first, last),
+        [&first, &last, &p, range]() { return std::find_if(first.base(), last.base(), p) - range->begin().base(); });
+    return range->begin() + static_cast<typename Range::difference_type>(offset);
+}
+
+template <class Range, class UnaryPredicate>
+inline stl_index::cached_range_iterator<Range> __cached_find_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate& p,
+    std::false_type)
+{
+    return stl_index::cached_range_iterator<Range>(first.container(), std::find_if(first.base(), last.base(), p));
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::count_if for cached_range ranges.
+ *
+ * <p>
+ * The result for a stateless predicate is looked up in the cache of the range, and computed and stored if the range
+ * changed or the cache evicted it. Other predicates are applied to every element.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Range, class UnaryPredicate>
+inline typename Range::difference_type count_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Range, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::cached_range_iterator<Range>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_index::cached_range_iterator<Range>>)),
+        // Return
+        (typename Range::difference_type)
+    )
+inline count_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate p)
+{
+    return __detail::__cached_count_if(first, last, p, std::is_empty<UnaryPredicate>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if for cached_range ranges.
+ *
+ * <p>
+ * The result for a stateless predicate is looked up in the cache of the range, and computed and stored if the range
+ * changed or the cache evicted it. Other predicates are applied to the elements up to the first one found.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Range, class UnaryPredicate>
+inline stl_index::cached_range_iterator<Range> find_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Range, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::cached_range_iterator<Range>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_index::cached_range_iterator<Range>>)),
+        // Return
+        (stl_index::cached_range_iterator<Range>)
+    )
+inline find_if(
+    stl_index::cached_range_iterator<Range> first,
+    stl_index::cached_range_iterator<Range> last,
+    UnaryPredicate p)
+{
+    return __detail::__cached_find_if(first, last, p, std::is_empty<UnaryPredicate>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_INDEX_RESULT_CACHE_HPP__
@@ -0,0 +1,514 @@
+/** @file */
+#ifndef __STL_INDEX_SUCCINCT_BIT_VECTOR_HPP__
+#define __STL_INDEX_SUCCINCT_BIT_VECTOR_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/bit_ops.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_index {
+
+class succinct_bit_vector;
+
+/**
+ * @brief Random access iterator over the bits of a succinct_bit_vector, dereferenced to bool.
+ *
+ * <p>
+ * It knows its container, so that stl_algorithm::count, stl_algorithm::find and stl_algorithm::any_of answer from the
+ * rank and select directories.
+ * </p>
+ */
+class succinct_bit_vector_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using reference = bool;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+
+    succinct_bit_vector_iterator()
+        : container_(nullptr)
+        , pos_(0)
+    {}
+
+    succinct_bit_vector_iterator(const succinct_bit_vector* container, std::size_t pos)
+        : container_(container)
+        , pos_(pos)
+    {}
+
+    /** @brief Returns the container of the bit. */
+    const succinct_bit_vector* container() const
+    {
+        return container_;
+    }
+
+    /** @brief Returns the position of the bit in its container. */
+    std::size_t index() const
+    {
+        return pos_;
+    }
+
+    inline reference operator*() const;
+
+    inline reference operator[](difference_type n) const;
+
+    succinct_bit_vector_iterator& operator++()
+    {
+        ++pos_;
+        return *this;
+    }
+
+    succinct_bit_vector_iterator operator++(int)
+    {
+        succinct_bit_vector_iterator tmp(*this);
+        ++pos_;
+        return tmp;
+    }
+
+    succinct_bit_vector_iterator& operator--()
+    {
+        --pos_;
+        return *this;
+    }
+
+    succinct_bit_vector_iterator operator--(int)
+    {
+        succinct_bit_vector_iterator tmp(*this);
+        --pos_;
+        return tmp;
+    }
+
+    succinct_bit_vector_iterator& operator+=(difference_type n)
+    {
+        pos_ = static_cast<std::size_t>(static_cast<difference_type>(pos_) + n);
+        return *this;
+    }
+
+    succinct_bit_vector_iterator& operator-=(difference_type n)
+    {
+        return *this += -n;
+    }
+
+    friend succinct_bit_vector_iterator operator+(succinct_bit_vector_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend succinct_bit_vector_iterator operator+(difference_type n, succinct_bit_vector_iterator it)
+    {
+        return it += n;
+    }
+
+    friend succinct_bit_vector_iterator operator-(succinct_bit_vector_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+    }
+
+    friend bool operator==(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return lhs.pos_ < rhs.pos_;
+    }
+
+    friend bool operator>(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const succinct_bit_vector_iterator& lhs, const succinct_bit_vector_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    const succinct_bit_vector* container_;
+    std::size_t pos_;
+};
+
+/**
+ * @brief Immutable bit vector with rank and select directories.
+ *
+ * <p>
+ * The bits are stored in 64-bit words. The rank directory stores a 64-bit count of set bits before each superblock of
+ * 65536 bits and a 16-bit count relative to the superblock before each block of 512 bits, so rank(i) adds two counts
+ * and at most 8 popcounts. The select directories store the block of every 8192nd set bit and of every 8192nd clear
+ * bit, select(k) binary searches the blocks between two samples. The directories take about 4% of the bits.
+ * </p>
+ * ```
+ * stl_index::succinct_bit_vector flags(rows.begin(), rows.end(), is_active);
+ * auto active = flags.rank(1000, 2000);
+ * auto tenth = flags.select(9);
+ * ```
+ */
+class succinct_bit_vector
+{
+public:
+    using value_type = bool;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = succinct_bit_vector_iterator;
+    using iterator = const_iterator;
+
+    succinct_bit_vector()
+        : size_(0)
+        , ones_(0)
+    {
+        build();
+    }
+
+    /**
+     * @brief Creates the bit vector with one bit per element of [first, last), set if p returns true for it.
+     * @tparam InputIt - must meet the requirements of <i>stl_concept::InputIterator</i>.
+     * @tparam UnaryPredicate - must meet the requirements of <i>stl_concept::UnaryPredicate</i>.
+     */
+    template <class InputIt, class UnaryPredicate>
+    succinct_bit_vector(InputIt first, InputIt last, UnaryPredicate p)
+        : size_(0)
+        , ones_(0)
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<InputIt>));
+        BOOST_CONCEPT_ASSERT((stl_algorithm::__detail::__UnaryPredicateProxy<UnaryPredicate, InputIt>));
+
+        std::uint64_t word = 0;
+        unsigned bit = 0;
+        for (; first != last; ++first) {
+            if (p(*first)) {
+                word |= std::uint64_t(1) << bit;
+            }
+            if (++bit == word_bits) {
+                words_.push_back(word);
+                word = 0;
+                bit = 0;
+            }
+            ++size_;
+        }
+        if (bit > 0) {
+            words_.push_back(word);
+        }
+        build();
+    }
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, size_);
+    }
+
+    bool operator[](size_type i) const
+    {
+        return (words_[i / word_bits] >> (i % word_bits)) & 1u;
+    }
+
+    bool test(size_type i) const
+    {
+        if (i >= size_) {
+            throw std::out_of_range("stl_index::succinct_bit_vector::test");
+        }
+        return (*this)[i];
+    }
+
+    /** @brief Returns the number of set bits. */
+    size_type count() const
+    {
+        return ones_;
+    }
+
+    /** @brief Returns the number of set bits in [0, i), i must be at most size(). */
+    size_type rank(size_type i) const
+    {
+        const size_type w = i / word_bits;
+        const size_type b = w / block_words;
+        size_type result = block_rank(b);
+        for (size_type k = b * block_words; k < w; ++k) {
+            result += stl_algorithm::__detail::__popcount(words_[k]);
+        }
+        return result + stl_algorithm::__detail::__popcount(
+            words_[w] & stl_algorithm::__detail::__low_mask(static_cast<unsigned>(i % word_bits)));
+    }
+
+    /** @brief Returns the number of set bits in [i, j), i must be at most j and j at most size(). */
+    size_type rank(size_type i, size_type j) const
+    {
+        return rank(j) - rank(i);
+    }
+
+    /** @brief Returns the number of clear bits in [0, i), i must be at most size(). */
+    size_type rank0(size_type i) const
+    {
+        return i - rank(i);
+    }
+
+    /** @brief Returns the position of the set bit which has k set bits before it, size() if there is none. */
+    size_type select(size_type k) const
+    {
+        return k < ones_ ? select_bit<true>(k) : size_;
+    }
+
+    /** @brief Returns the position of the clear bit which has k clear bits before it, size() if there is none. */
+    size_type select0(size_type k) const
+    {
+        return k < size_ - ones_ ? select_bit<false>(k) : size_;
+    }
+
+    /** @brief Returns the number of bytes used by the bits and the directories. */
+    size_type memory_usage() const
+    {
+        return words_.size() * sizeof(std::uint64_t) + superblocks_.size() * sizeof(std::uint64_t) +
+            blocks_.size() * sizeof(std::uint16_t) +
+            (samples_[0].size() + samples_[1].size()) * sizeof(std::uint64_t);
+    }
+
+private:
+    static constexpr unsigned word_bits = 64;
+    static constexpr size_type block_words = 8;
+    static constexpr size_type block_bits = block_words * word_bits;
+    static constexpr size_type superblock_blocks = 128;
+    static constexpr size_type sample_rate = 8192;
+
+    /** @brief Builds the directories, the words are followed by a zero word so that rank(size()) reads a word. */
+    void build()
+    {
+        words_.resize(size_ / word_bits + 1, 0);
+        const size_type block_count = (words_.size() + block_words - 1) / block_words;
+        blocks_.resize(block_count);
+        size_type ones = 0;
+        size_type superblock_ones = 0;
+        size_type next_sample[2] = {0, 0};
+        for (size_type b = 0; b < block_count; ++b) {
+            if (b % superblock_blocks == 0) {
+                superblocks_.push_back(ones);
+                superblock_ones = ones;
+            }
+            blocks_[b] = static_cast<std::uint16_t>(ones - superblock_ones);
+            for (size_type w = b * block_words; w < (b + 1) * block_words && w < words_.size(); ++w) {
+                ones += stl_algorithm::__detail::__popcount(words_[w]);
+            }
+            const size_type bits = (b + 1) * block_bits < size_ ? (b + 1) * block_bits : size_;
+            const size_type counts[2] = {bits - ones, ones};
+            for (int bit = 0; bit < 2; ++bit) {
+                for (; next_sample[bit] < counts[bit]; next_sample[bit] += sample_rate) {
+                    samples_[bit].push_back(b);
+                }
+            }
+        }
+        ones_ = ones;
+    }
+
+    size_type block_rank(size_type b) const
+    {
+        return static_cast<size_type>(superblocks_[b / superblock_blocks]) + blocks_[b];
+    }
+
+    template <bool Bit>
+    size_type block_rank_of(size_type b) const
+    {
+        return Bit ? block_rank(b) : b * block_bits - block_rank(b);
+    }
+
+    template <bool Bit>
+    size_type select_bit(size_type k) const
+    {
+        const std::vector<std::uint64_t>& samples = samples_[Bit];
+        const size_type sample = k / sample_rate;
+        size_type lo = static_cast<size_type>(samples[sample]);
+        size_type hi = sample + 1 < samples.size() ? static_cast<size_type>(samples[sample + 1]) + 1 : blocks_.size();
+        while (hi - lo > 1) {
+            const size_type mid = lo + (hi - lo) / 2;
+            if (block_rank_of<Bit>(mid) <= k) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        k -= block_rank_of<Bit>(lo);
+        for (size_type w = lo * block_words;; ++w) {
+            const std::uint64_t word = Bit ? words_[w] : ~words_[w];
+            const size_type ones = stl_algorithm::__detail::__popcount(word);
+            if (k < ones) {
+                return w * word_bits + stl_algorithm::__detail::__select_in_word(word, static_cast<unsigned>(k));
+            }
+            k -= ones;
+        }
+    }
+
+    size_type size_;
+    size_type ones_;
+    std::vector<std::uint64_t> words_;
+    std::vector<std::uint64_t> superblocks_;
+    std::vector<std::uint16_t> blocks_;
+    std::vector<std::uint64_t> samples_[2];
+};
+
+inline succinct_bit_vector_iterator::reference succinct_bit_vector_iterator::operator*() const
+{
+    return (*container_)[pos_];
+}
+
+inline succinct_bit_vector_iterator::reference succinct_bit_vector_iterator::operator[](difference_type n) const
+{
+    return *(*this + n);
+}
+
+} // namespace stl_index
+
+namespace stl_algorithm {
+
+/**
+ * @brief Overload of stl_algorithm::count for succinct_bit_vector ranges, in constant time with rank.
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class T>
+inline std::ptrdiff_t count(
+    stl_index::succinct_bit_vector_iterator first,
+    stl_index::succinct_bit_vector_iterator last,
+    const T& value);
+#else // DOXYGEN_WORKING
+template <class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::succinct_bit_vector_iterator>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(
+    stl_index::succinct_bit_vector_iterator first,
+    stl_index::succinct_bit_vector_iterator last,
+    const T& value)
+{
+    if (first == last) {
+        return 0;
+    }
+    const std::ptrdiff_t ones = static_cast<std::ptrdiff_t>(first.container()->rank(first.index(), last.index()));
+    return (true == value ? ones : 0) + (false == value ? (last - first) - ones : 0);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find for succinct_bit_vector ranges, which jumps to the next set or clear bit
+ * with rank and select.
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class T>
+inline stl_index::succinct_bit_vector_iterator find(
+    stl_index::succinct_bit_vector_iterator first,
+    stl_index::succinct_bit_vector_iterator last,
+    const T& value);
+#else // DOXYGEN_WORKING
+template <class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::succinct_bit_vector_iterator>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (stl_index::succinct_bit_vector_iterator)
+    )
+inline find(
+    stl_index::succinct_bit_vector_iterator first,
+    stl_index::succinct_bit_vector_iterator last,
+    const T& value)
+{
+    if (first == last) {
+        return last;
+    }
+    const bool match_true = true == value;
+    const bool match_false = false == value;
+    if (match_true && match_false) {
+        return first;
+    }
+    if (!match_true && !match_false) {
+        return last;
+    }
+    const stl_index::succinct_bit_vector& bits = *first.container();
+    const std::size_t found = match_true
+        ? bits.select(bits.rank(first.index()))
+        : bits.select0(bits.rank0(first.index()));
+    return found < last.index() ? stl_index::succinct_bit_vector_iterator(&bits, found) : last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for succinct_bit_vector ranges.
+ *
+ * <p>
+ * The predicate is applied to true and false once each, and the result is decided by counting the set bits of the
+ * range with rank.
+ * </p>
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool any_of(
+    stl_index::succinct_bit_vector_iterator first,
+    stl_index::succinct_bit_vector_iterator last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::succinct_bit_vector_iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_index::succinct_bit_vector_iterator>)),
+        // Return
+        (bool)
+    )
+inline any_of(
+    stl_index::succinct_bit_vector_iterator first,
+    stl_index::succinct_bit_vector_iterator last,
+    UnaryPredicate p)
+{
+    if (first == last) {
+        return false;
+    }
+    const std::size_t ones = first.container()->rank(first.index(), last.index());
+    return (ones > 0 && p(true)) || (ones < static_cast<std::size_t>(last - first) && p(false));
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_INDEX_SUCCINCT_BIT_VECTOR_HPP__
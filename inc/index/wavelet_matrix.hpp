@@ -0,0 +1,234 @@
+/** @file */
+#ifndef __STL_INDEX_WAVELET_MATRIX_HPP__
+#define __STL_INDEX_WAVELET_MATRIX_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/forward_iterator.hpp"
+#include "concept/integral.hpp"
+#include "index/succinct_bit_vector.hpp"
+
+namespace stl_index {
+
+/**
+ * @brief Wavelet matrix over a sequence of integral values, answering counting and order queries on any subrange
+ * [i, j) in O(log sigma), where sigma is the number of distinct values.
+ *
+ * <p>
+ * The values are replaced by their ranks in the sorted distinct values, of log sigma bits each. Each level of the
+ * matrix is a succinct_bit_vector of one bit of the ranks, in the order given by a stable partition on the bits of
+ * the previous levels, so the index takes n log sigma bits plus the rank and select directories and the sorted
+ * distinct values. The sequence itself is not needed after construction.
+ * </p>
+ * ```
+ * stl_index::wavelet_matrix<int> index(column.begin(), column.end());
+ * auto occurrences = index.count(i, j, 42);   // stl_algorithm::count(column.begin() + i, column.begin() + j, 42)
+ * auto median = index.kth_smallest(i, j, (j - i) / 2);
+ * ```
+ * @tparam T - must meet the requirements of <i>stl_concept::Integral</i>.
+ */
+template <class T>
+class wavelet_matrix
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::Integral<T>));
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    wavelet_matrix()
+        : size_(0)
+    {}
+
+    /**
+     * @brief Creates the index of the values in [first, last).
+     * @tparam ForwardIt - must meet the requirements of <i>stl_concept::ForwardIterator</i>, and its value type must
+     * be convertible to T.
+     */
+    template <class ForwardIt>
+    wavelet_matrix(ForwardIt first, ForwardIt last)
+        : alphabet_(first, last)
+        , size_(alphabet_.size())
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<ForwardIt>));
+
+        std::sort(alphabet_.begin(), alphabet_.end());
+        alphabet_.erase(std::unique(alphabet_.begin(), alphabet_.end()), alphabet_.end());
+        alphabet_.shrink_to_fit();
+
+        std::vector<std::uint64_t> codes;
+        codes.reserve(size_);
+        for (; first != last; ++first) {
+            codes.push_back(code(*first));
+        }
+
+        const std::uint64_t max_code = alphabet_.empty() ? 0 : alphabet_.size() - 1;
+        unsigned depth = 0;
+        while (depth < 64 && max_code >> depth != 0) {
+            ++depth;
+        }
+        std::vector<std::uint64_t> ones;
+        for (unsigned level = 0; level < depth; ++level) {
+            const unsigned shift = depth - 1 - level;
+            levels_.push_back(succinct_bit_vector(codes.begin(), codes.end(), [shift](std::uint64_t c) {
+                return ((c >> shift) & 1u) != 0;
+            }));
+            zeros_.push_back(size_ - levels_.back().count());
+
+            // Stable partition of the codes on the bit of the level, zeros first.
+            ones.clear();
+            auto out = codes.begin();
+            for (std::uint64_t c : codes) {
+                if ((c >> shift) & 1u) {
+                    ones.push_back(c);
+                } else {
+                    *out++ = c;
+                }
+            }
+            std::copy(ones.begin(), ones.end(), out);
+        }
+    }
+
+    /** @brief Returns the number of indexed values. */
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    /** @brief Returns the number of distinct values. */
+    size_type distinct() const
+    {
+        return alphabet_.size();
+    }
+
+    /** @brief Returns the value at position i, in O(log sigma). */
+    T operator[](size_type i) const
+    {
+        std::uint64_t c = 0;
+        for (size_type level = 0; level < levels_.size(); ++level) {
+            const succinct_bit_vector& bits = levels_[level];
+            c <<= 1;
+            if (bits[i]) {
+                c |= 1u;
+                i = zeros_[level] + bits.rank(i);
+            } else {
+                i = bits.rank0(i);
+            }
+        }
+        return alphabet_[static_cast<size_type>(c)];
+    }
+
+    /** @brief Returns the number of values equal to value in [i, j). */
+    size_type count(size_type i, size_type j, T value) const
+    {
+        check(i, j, "stl_index::wavelet_matrix::count");
+        auto found = std::lower_bound(alphabet_.begin(), alphabet_.end(), value);
+        if (found == alphabet_.end() || *found != value) {
+            return 0;
+        }
+        const std::uint64_t c = static_cast<std::uint64_t>(found - alphabet_.begin());
+        for (size_type level = 0; level < levels_.size(); ++level) {
+            const succinct_bit_vector& bits = levels_[level];
+            if ((c >> (levels_.size() - 1 - level)) & 1u) {
+                i = zeros_[level] + bits.rank(i);
+                j = zeros_[level] + bits.rank(j);
+            } else {
+                i = bits.rank0(i);
+                j = bits.rank0(j);
+            }
+        }
+        return j - i;
+    }
+
+    /** @brief Returns the number of values less than value in [i, j). */
+    size_type count_less(size_type i, size_type j, T value) const
+    {
+        check(i, j, "stl_index::wavelet_matrix::count_less");
+        const std::uint64_t c = static_cast<std::uint64_t>(
+            std::lower_bound(alphabet_.begin(), alphabet_.end(), value) - alphabet_.begin());
+        if (c == alphabet_.size()) {
+            return j - i;
+        }
+        size_type result = 0;
+        for (size_type level = 0; level < levels_.size(); ++level) {
+            const succinct_bit_vector& bits = levels_[level];
+            if ((c >> (levels_.size() - 1 - level)) & 1u) {
+                result += bits.rank0(j) - bits.rank0(i);
+                i = zeros_[level] + bits.rank(i);
+                j = zeros_[level] + bits.rank(j);
+            } else {
+                i = bits.rank0(i);
+                j = bits.rank0(j);
+            }
+        }
+        return result;
+    }
+
+    /** @brief Returns the value which has k values before it when [i, j) is sorted, k must be less than j - i. */
+    T kth_smallest(size_type i, size_type j, size_type k) const
+    {
+        check(i, j, "stl_index::wavelet_matrix::kth_smallest");
+        if (k >= j - i) {
+            throw std::out_of_range("stl_index::wavelet_matrix::kth_smallest");
+        }
+        std::uint64_t c = 0;
+        for (size_type level = 0; level < levels_.size(); ++level) {
+            const succinct_bit_vector& bits = levels_[level];
+            const size_type zeros = bits.rank0(j) - bits.rank0(i);
+            c <<= 1;
+            if (k < zeros) {
+                i = bits.rank0(i);
+                j = bits.rank0(j);
+            } else {
+                k -= zeros;
+                c |= 1u;
+                i = zeros_[level] + bits.rank(i);
+                j = zeros_[level] + bits.rank(j);
+            }
+        }
+        return alphabet_[static_cast<size_type>(c)];
+    }
+
+    /** @brief Returns the number of bytes used by the levels and the distinct values. */
+    size_type memory_usage() const
+    {
+        size_type result = alphabet_.size() * sizeof(T) + zeros_.size() * sizeof(size_type);
+        for (const succinct_bit_vector& bits : levels_) {
+            result += bits.memory_usage();
+        }
+        return result;
+    }
+
+private:
+    std::uint64_t code(T value) const
+    {
+        return static_cast<std::uint64_t>(std::lower_bound(alphabet_.begin(), alphabet_.end(), value) -
+            alphabet_.begin());
+    }
+
+    void check(size_type i, size_type j, const char* what) const
+    {
+        if (i > j || j > size_) {
+            throw std::out_of_range(what);
+        }
+    }
+
+    std::vector<T> alphabet_;
+    size_type size_;
+    std::vector<succinct_bit_vector> levels_;
+    std::vector<size_type> zeros_;
+};
+
+} // namespace stl_index
+
+#endif  // __STL_INDEX_WAVELET_MATRIX_HPP__
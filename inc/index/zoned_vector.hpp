@@ -0,0 +1,743 @@
+/** @file */
+#ifndef __STL_INDEX_ZONED_VECTOR_HPP__
+#define __STL_INDEX_ZONED_VECTOR_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/copy_insertable.hpp"
+#include "concept/equality_comparable_with.hpp"
+#include "concept/erasable.hpp"
+#include "concept/input_iterator.hpp"
+#include "concept/less_than_comparable.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+#include "index/detail/container_iterator.hpp"
+
+namespace stl_index {
+
+/**
+ * @brief Predicate which returns true for the values in the closed interval [low, high], compared with < operator.
+ *
+ * The algorithms over zoned_vector ranges read its bounds to skip the blocks which cannot hold such a value.
+ * @tparam T - type of the bounds
+ */
+template <class T>
+struct between
+{
+    T low;
+    T high;
+
+    template <class U>
+    bool operator()(const U& value) const
+    {
+        return !(value < low) && !(high < value);
+    }
+};
+
+/** @brief Creates the predicate which returns true for the values in [low, high]. */
+template <class T>
+inline between<T> make_between(T low, T high)
+{
+    return between<T>{std::move(low), std::move(high)};
+}
+
+/// @cond DEV
+namespace __detail {
+
+struct __zoned_vector_tag
+{};
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Random access iterator over the elements of a zoned_vector.
+ *
+ * The elements are constant, so that the zone map stays exact, and the algorithms read the zone map to skip blocks.
+ * @tparam Container - zoned_vector type
+ */
+template <class Container>
+using zoned_vector_iterator = __detail::__const_container_iterator<Container, __detail::__zoned_vector_tag>;
+
+/**
+ * @brief Sequence container which keeps the minimum and the maximum of each block of its elements up to date, so that
+ * searches for a value or for an interval of values skip the blocks which cannot match.
+ *
+ * <p>
+ * It stores the elements in a std::vector and, for each block of BlockSize consecutive elements, the smallest and the
+ * largest of them with respect to < operator. This zone map is updated by every modifier: appending or replacing an
+ * element widens the zone of its block, and removing or replacing one of its bounds rescans the block. Elements are not
+ * assignable through references or iterators, they are changed with replace().<br/>
+ * stl_algorithm::find, and stl_algorithm::find_if, count_if, any_of and none_of with a stl_index::between predicate
+ * skip the blocks whose zone is outside the searched value or interval, and count_if counts the blocks whose zone is
+ * inside the interval without reading them. Clustered data, such as timestamps or identifiers which mostly grow, have
+ * narrow zones and most blocks are skipped.<br/>
+ * Like those of std::vector, the iterators follow the elements to the other container on swap or move. The searches
+ * over such iterators scan the elements, since the zones of their container do not describe them any more.
+ * </p>
+ * ```
+ * stl_index::zoned_vector<std::int64_t> timestamps(first, last);
+ * auto n = stl_algorithm::count_if(timestamps.begin(), timestamps.end(), stl_index::make_between(from, to));
+ * ```
+ * @tparam T - value type, must meet the requirements of <i>stl_concept::CopyInsertable</i>,
+ * <i>stl_concept::Erasable</i> and <i>stl_concept::LessThanComparable</i>
+ * @tparam BlockSize - number of elements summarized by each zone
+ * @tparam Allocator - allocator of the elements
+ */
+template <class T, std::size_t BlockSize = 4096, class Allocator = std::allocator<T>>
+class zoned_vector
+{
+public:
+    using base_type = std::vector<T, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = typename base_type::size_type;
+    using difference_type = typename base_type::difference_type;
+    using reference = const T&;
+    using const_reference = const T&;
+    using pointer = typename base_type::const_pointer;
+    using const_pointer = typename base_type::const_pointer;
+    using const_iterator = zoned_vector_iterator<zoned_vector>;
+    using iterator = const_iterator;
+
+    /** @brief Smallest and largest elements of a block. */
+    struct zone
+    {
+        T min;
+        T max;
+    };
+
+    /** @brief Number of elements summarized by each zone. */
+    static constexpr size_type block_size = BlockSize;
+
+private:
+    static_assert(BlockSize > 0, "stl_index::zoned_vector: BlockSize must be positive");
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyInsertable<T, base_type>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Erasable<T, base_type>));
+    BOOST_CONCEPT_ASSERT((stl_concept::LessThanComparable<T>));
+
+    using __ZoneAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<zone>;
+
+public:
+    zoned_vector() = default;
+
+    explicit zoned_vector(const Allocator& alloc)
+        : elements_(alloc)
+        , zones_(__ZoneAllocator(alloc))
+    {}
+
+    template <class InputIt>
+    zoned_vector(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : zoned_vector(alloc)
+    {
+        assign(first, last);
+    }
+
+    zoned_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator())
+        : zoned_vector(init.begin(), init.end(), alloc)
+    {}
+
+    zoned_vector(size_type n, const T& value, const Allocator& alloc = Allocator())
+        : zoned_vector(alloc)
+    {
+        assign(n, value);
+    }
+
+    /** @brief Returns the zones of the blocks, the last block may have less than BlockSize elements. */
+    const std::vector<zone, __ZoneAllocator>& zones() const
+    {
+        return zones_;
+    }
+
+    /** @brief Returns the underlying vector. */
+    const base_type& base() const
+    {
+        return elements_;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return elements_.get_allocator();
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, elements_.begin());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, elements_.end());
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    size_type size() const
+    {
+        return elements_.size();
+    }
+
+    bool empty() const
+    {
+        return elements_.empty();
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        return elements_[pos];
+    }
+
+    const_reference at(size_type pos) const
+    {
+        return elements_.at(pos);
+    }
+
+    const_reference front() const
+    {
+        return elements_.front();
+    }
+
+    const_reference back() const
+    {
+        return elements_.back();
+    }
+
+    const_pointer data() const
+    {
+        return elements_.data();
+    }
+
+    void reserve(size_type n)
+    {
+        elements_.reserve(n);
+        zones_.reserve((n + BlockSize - 1) / BlockSize);
+    }
+
+    /** @brief Replaces the element at pos with value. */
+    void replace(const_iterator pos, const T& value)
+    {
+        const size_type i = static_cast<size_type>(pos - begin());
+        zone& z = zones_[i / BlockSize];
+        // The zone only shrinks if the replaced element is one of its bounds, the block is then scanned again.
+        const bool shrinks = (!(z.min < elements_[i]) && z.min < value) || (!(elements_[i] < z.max) && value < z.max);
+        elements_[i] = value;
+        if (shrinks) {
+            rezone(i / BlockSize);
+        } else {
+            widen(z, value);
+        }
+    }
+
+    void push_back(const T& value)
+    {
+        elements_.push_back(value);
+        zone_or_pop_back();
+    }
+
+    void push_back(T&& value)
+    {
+        elements_.push_back(std::move(value));
+        zone_or_pop_back();
+    }
+
+    template <class... Args>
+    void emplace_back(Args&&... args)
+    {
+        elements_.emplace_back(std::forward<Args>(args)...);
+        zone_or_pop_back();
+    }
+
+    void pop_back()
+    {
+        const zone& z = zones_.back();
+        const bool bound = !(z.min < elements_.back()) || !(elements_.back() < z.max);
+        elements_.pop_back();
+        if (elements_.size() % BlockSize == 0) {
+            zones_.pop_back();
+        } else if (bound) {
+            rezone(zones_.size() - 1);
+        }
+    }
+
+    const_iterator insert(const_iterator pos, const T& value)
+    {
+        const difference_type offset = pos - begin();
+        elements_.insert(pos.base(), value);
+        rezone_from(static_cast<size_type>(offset));
+        return begin() + offset;
+    }
+
+    template <class InputIt>
+    const_iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const difference_type offset = pos - begin();
+        elements_.insert(elements_.begin() + offset, first, last);
+        rezone_from(static_cast<size_type>(offset));
+        return begin() + offset;
+    }
+
+    const_iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    const_iterator erase(const_iterator first, const_iterator last)
+    {
+        const difference_type offset = first - begin();
+        elements_.erase(first.base(), last.base());
+        rezone_from(static_cast<size_type>(offset));
+        return begin() + offset;
+    }
+
+    template <class InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        elements_.assign(first, last);
+        rezone_from(0);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    void assign(size_type n, const T& value)
+    {
+        elements_.assign(n, value);
+        zones_.assign((n + BlockSize - 1) / BlockSize, zone{value, value});
+    }
+
+    void clear()
+    {
+        elements_.clear();
+        zones_.clear();
+    }
+
+    void swap(zoned_vector& other)
+    {
+        elements_.swap(other.elements_);
+        zones_.swap(other.zones_);
+    }
+
+    friend bool operator==(const zoned_vector& lhs, const zoned_vector& rhs)
+    {
+        return lhs.elements_ == rhs.elements_;
+    }
+
+    friend bool operator!=(const zoned_vector& lhs, const zoned_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static void widen(zone& z, const T& value)
+    {
+        if (value < z.min) {
+            z.min = value;
+        }
+        if (z.max < value) {
+            z.max = value;
+        }
+    }
+
+    /** @brief Computes the zone of the given block again. */
+    void rezone(size_type block)
+    {
+        const size_type first = block * BlockSize;
+        const size_type last = std::min(first + BlockSize, elements_.size());
+        zone z{elements_[first], elements_[first]};
+        for (size_type i = first + 1; i < last; ++i) {
+            widen(z, elements_[i]);
+        }
+        zones_[block] = std::move(z);
+    }
+
+    /** @brief Computes the zones of the blocks from the one of the element at pos. */
+    void rezone_from(size_type pos)
+    {
+        const size_type blocks = (elements_.size() + BlockSize - 1) / BlockSize;
+        const size_type kept = std::min(pos / BlockSize, zones_.size());
+        zones_.erase(zones_.begin() + static_cast<difference_type>(kept), zones_.end());
+        while (zones_.size() < blocks) {
+            const size_type block = zones_.size();
+            zones_.push_back(zone{elements_[block * BlockSize], elements_[block * BlockSize]});
+            rezone(block);
+        }
+    }
+
+    /** @brief Adds the last element to the zone map, removes it if the map cannot be updated. */
+    void zone_or_pop_back()
+    {
+        const T& value = elements_.back();
+        if ((elements_.size() - 1) % BlockSize != 0) {
+            widen(zones_.back(), value);
+            return;
+        }
+        try {
+            zones_.push_back(zone{value, value});
+        } catch (...) {
+            elements_.pop_back();
+            throw;
+        }
+    }
+
+    base_type elements_;
+    std::vector<zone, __ZoneAllocator> zones_;
+};
+
+template <class T, std::size_t BlockSize, class Allocator>
+inline void swap(zoned_vector<T, BlockSize, Allocator>& lhs, zoned_vector<T, BlockSize, Allocator>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stl_index
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Zone tests of a search for value, which a zone may hold if it is not outside [value, value]. */
+template <class U>
+struct __zone_value
+{
+    const U& value;
+
+    template <class Zone>
+    bool may_match(const Zone& z) const
+    {
+        return !(value < z.min) && !(z.max < value);
+    }
+
+    template <class Zone>
+    bool must_match(const Zone&) const
+    {
+        return false;
+    }
+
+    template <class V>
+    bool operator()(const V& v) const
+    {
+        return v == value;
+    }
+};
+
+/** @brief Zone tests of a stl_index::between predicate. */
+template <class U>
+struct __zone_between
+{
+    const stl_index::between<U>& p;
+
+    template <class Zone>
+    bool may_match(const Zone& z) const
+    {
+        return !(z.max < p.low) && !(p.high < z.min);
+    }
+
+    template <class Zone>
+    bool must_match(const Zone& z) const
+    {
+        return !(z.min < p.low) && !(p.high < z.max);
+    }
+
+    template <class V>
+    bool operator()(const V& v) const
+    {
+        return p(v);
+    }
+};
+
+/**
+ * @brief Returns whether the non-empty range [first, last) lies in the elements of first.container(), which it does not
+ * once the container was swapped or moved from, the iterators then referring to the elements of another container.
+ *
+ * The addresses of the elements are compared, since the iterators of different vectors cannot be.
+ */
+template <class Container>
+inline bool __in_container(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last)
+{
+    const Container* c = first.container();
+    if (c == nullptr) {
+        return false;
+    }
+    const typename Container::value_type* front = std::addressof(*first.base());
+    const typename Container::value_type* back = std::addressof(*std::prev(last.base()));
+    const std::less<const typename Container::value_type*> less;
+    return !less(front, c->data()) && less(back, c->data() + c->size());
+}
+
+/**
+ * @brief Returns the first element of [first, last) which matches, reading the blocks which may hold it only, or
+ * scanning the elements when they are not in first.container() any more.
+ */
+template <class Container, class Test>
+inline stl_index::zoned_vector_iterator<Container> __zoned_find(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const Test& test)
+{
+    if (first == last || !__in_container(first, last)) {
+        return stl_index::zoned_vector_iterator<Container>(
+            first.container(),
+            std::find_if(first.base(), last.base(), test));
+    }
+    using size_type = typename Container::size_type;
+    const Container& c = *first.container();
+    size_type i = static_cast<size_type>(first - c.begin());
+    const size_type end = static_cast<size_type>(last - c.begin());
+    while (i < end) {
+        const size_type block = i / Container::block_size;
+        const size_type block_end = std::min(end, (block + 1) * Container::block_size);
+        if (test.may_match(c.zones()[block])) {
+            for (; i < block_end; ++i) {
+                if (test(c[i])) {
+                    return c.begin() + static_cast<typename Container::difference_type>(i);
+                }
+            }
+        }
+        i = block_end;
+    }
+    return last;
+}
+
+/**
+ * @brief Counts the elements of [first, last) which match, reading the blocks which may hold some but not all, or
+ * scanning the elements when they are not in first.container() any more.
+ */
+template <class Container, class Test>
+inline typename Container::difference_type __zoned_count(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const Test& test)
+{
+    if (first == last || !__in_container(first, last)) {
+        return std::count_if(first.base(), last.base(), test);
+    }
+    using size_type = typename Container::size_type;
+    const Container& c = *first.container();
+    size_type i = static_cast<size_type>(first - c.begin());
+    const size_type end = static_cast<size_type>(last - c.begin());
+    size_type count = 0;
+    while (i < end) {
+        const size_type block = i / Container::block_size;
+        const size_type block_end = std::min(end, (block + 1) * Container::block_size);
+        const auto& z = c.zones()[block];
+        if (test.must_match(z)) {
+            count += block_end - i;
+        } else if (test.may_match(z)) {
+            for (size_type j = i; j < block_end; ++j) {
+                count += test(c[j]) ? 1u : 0u;
+            }
+        }
+        i = block_end;
+    }
+    return static_cast<typename Container::difference_type>(count);
+}
+
+template <class Container, class Test>
+inline bool __zoned_any(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const Test& test)
+{
+    return __zoned_find(first, last, test) != last;
+}
+
+template <class Container, class U>
+inline stl_index::zoned_vector_iterator<Container> __zoned_vector_find(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const U& value,
+    std::true_type)
+{
+    return __zoned_find(first, last, __zone_value<U>{value});
+}
+
+template <class Container, class U>
+inline stl_index::zoned_vector_iterator<Container> __zoned_vector_find(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const U& value,
+    std::false_type)
+{
+    return stl_index::zoned_vector_iterator<Container>(first.container(), std::find(first.base(), last.base(), value));
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::find for zoned_vector ranges.
+ *
+ * <p>
+ * Searching a value of the element type skips the blocks whose zone does not contain it, values of other types are
+ * searched by scanning.
+ * </p>
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class Container, class U>
+inline stl_index::zoned_vector_iterator<Container> find(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class Container, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::zoned_vector_iterator<Container>>))
+        ((stl_concept::EqualityComparableWith<typename Container::value_type, U>)),
+        // Return
+        (stl_index::zoned_vector_iterator<Container>)
+    )
+inline find(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    const U& value)
+{
+    return __detail::__zoned_vector_find(first, last, value, std::is_same<typename Container::value_type, U>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if for zoned_vector ranges and stl_index::between predicates, which skips
+ * the blocks whose zone is outside the interval.
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Container, class U>
+inline stl_index::zoned_vector_iterator<Container> find_if(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p);
+#else // DOXYGEN_WORKING
+template <class Container, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::zoned_vector_iterator<Container>>))
+        ((__detail::__UnaryPredicateProxy<stl_index::between<U>, stl_index::zoned_vector_iterator<Container>>)),
+        // Return
+        (stl_index::zoned_vector_iterator<Container>)
+    )
+inline find_if(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p)
+{
+    return __detail::__zoned_find(first, last, __detail::__zone_between<U>{p});
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for zoned_vector ranges and stl_index::between predicates.
+ *
+ * <p>
+ * The blocks whose zone is outside the interval are skipped, the ones whose zone is inside the interval are counted
+ * without reading their elements.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Container, class U>
+inline typename Container::difference_type count_if(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p);
+#else // DOXYGEN_WORKING
+template <class Container, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::zoned_vector_iterator<Container>>))
+        ((__detail::__UnaryPredicateProxy<stl_index::between<U>, stl_index::zoned_vector_iterator<Container>>)),
+        // Return
+        (typename Container::difference_type)
+    )
+inline count_if(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p)
+{
+    return __detail::__zoned_count(first, last, __detail::__zone_between<U>{p});
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for zoned_vector ranges and stl_index::between predicates, which skips
+ * the blocks whose zone is outside the interval.
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Container, class U>
+inline bool any_of(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p);
+#else // DOXYGEN_WORKING
+template <class Container, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::zoned_vector_iterator<Container>>))
+        ((__detail::__UnaryPredicateProxy<stl_index::between<U>, stl_index::zoned_vector_iterator<Container>>)),
+        // Return
+        (bool)
+    )
+inline any_of(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p)
+{
+    return __detail::__zoned_any(first, last, __detail::__zone_between<U>{p});
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::none_of for zoned_vector ranges and stl_index::between predicates, which skips
+ * the blocks whose zone is outside the interval.
+ * @see stl_algorithm::none_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Container, class U>
+inline bool none_of(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p);
+#else // DOXYGEN_WORKING
+template <class Container, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_index::zoned_vector_iterator<Container>>))
+        ((__detail::__UnaryPredicateProxy<stl_index::between<U>, stl_index::zoned_vector_iterator<Container>>)),
+        // Return
+        (bool)
+    )
+inline none_of(
+    stl_index::zoned_vector_iterator<Container> first,
+    stl_index::zoned_vector_iterator<Container> last,
+    stl_index::between<U> p)
+{
+    return !__detail::__zoned_any(first, last, __detail::__zone_between<U>{p});
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_INDEX_ZONED_VECTOR_HPP__
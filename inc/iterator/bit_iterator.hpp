@@ -0,0 +1,889 @@
+/** @file */
+#ifndef __STL_ITERATOR_BIT_ITERATOR_HPP__
+#define __STL_ITERATOR_BIT_ITERATOR_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "concept/unsigned_integral.hpp"
+#include "algorithm/detail/bit_ops.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief Proxy reference to a bit of a word, returned by dereferencing a mutable bit_iterator.
+ * @tparam Word - unsigned integral type of the words
+ */
+template <class Word>
+class bit_reference
+{
+public:
+    bit_reference(Word* word, unsigned offset)
+        : word_(word)
+        , mask_(static_cast<Word>(Word(1) << offset))
+    {}
+
+    operator bool() const
+    {
+        return (*word_ & mask_) != 0;
+    }
+
+    bit_reference& operator=(bool value)
+    {
+        if (value) {
+            *word_ = static_cast<Word>(*word_ | mask_);
+        } else {
+            *word_ = static_cast<Word>(*word_ & ~mask_);
+        }
+        return *this;
+    }
+
+    bit_reference& operator=(const bit_reference& other)
+    {
+        return *this = static_cast<bool>(other);
+    }
+
+    bool operator~() const
+    {
+        return !static_cast<bool>(*this);
+    }
+
+    void flip()
+    {
+        *word_ = static_cast<Word>(*word_ ^ mask_);
+    }
+
+    friend void swap(bit_reference lhs, bit_reference rhs)
+    {
+        const bool tmp = lhs;
+        lhs = static_cast<bool>(rhs);
+        rhs = tmp;
+    }
+
+    friend void swap(bit_reference lhs, bool& rhs)
+    {
+        const bool tmp = lhs;
+        lhs = rhs;
+        rhs = tmp;
+    }
+
+    friend void swap(bool& lhs, bit_reference rhs)
+    {
+        swap(rhs, lhs);
+    }
+
+private:
+    Word* word_;
+    Word mask_;
+};
+
+/**
+ * @brief Random access iterator over the bits of an array of words, bit i being bit i % digits of word
+ * i / digits, like the bits of std::vector<bool>.
+ *
+ * <p>
+ * It is dereferenced to a bit_reference, or to bool if Word is const. stl_algorithm::count, find, all_of, any_of,
+ * none_of, equal and mismatch have overloads for it and for the iterators of std::vector<bool> which work on whole
+ * words, with popcount, count trailing zeros and XOR, instead of one bit at a time.
+ * </p>
+ * ```
+ * std::vector<std::uint64_t> flags(1024);
+ * auto first = stl_iterator::make_bit_iterator(flags.data());
+ * auto set = stl_algorithm::count(first, first + 65536, true);
+ * ```
+ * @tparam Word - unsigned integral type of the words, const qualified for a constant iterator
+ */
+template <class Word>
+class bit_iterator
+{
+    using __WordType = typename std::remove_const<Word>::type;
+    BOOST_CONCEPT_ASSERT((stl_concept::UnsignedIntegral<__WordType>));
+
+    static constexpr unsigned __digits = std::numeric_limits<__WordType>::digits;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using reference = typename std::conditional<std::is_const<Word>::value, bool, bit_reference<Word>>::type;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using word_type = __WordType;
+
+    bit_iterator()
+        : words_(nullptr)
+        , pos_(0)
+    {}
+
+    bit_iterator(Word* words, std::size_t pos)
+        : words_(words)
+        , pos_(pos)
+    {}
+
+    /** @brief Converts a mutable iterator to a constant iterator. */
+    template <class OtherWord, class = typename std::enable_if<
+        std::is_same<const OtherWord, Word>::value && !std::is_same<OtherWord, Word>::value>::type>
+    bit_iterator(const bit_iterator<OtherWord>& other)
+        : words_(other.words())
+        , pos_(other.offset())
+    {}
+
+    /** @brief Returns the word holding the bit. */
+    Word* words() const
+    {
+        return words_ + pos_ / __digits;
+    }
+
+    /** @brief Returns the position of the bit in words(). */
+    unsigned offset() const
+    {
+        return static_cast<unsigned>(pos_ % __digits);
+    }
+
+    reference operator*() const
+    {
+        return dereference(std::is_const<Word>());
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    bit_iterator& operator++()
+    {
+        ++pos_;
+        return *this;
+    }
+
+    bit_iterator operator++(int)
+    {
+        bit_iterator tmp(*this);
+        ++pos_;
+        return tmp;
+    }
+
+    bit_iterator& operator--()
+    {
+        --pos_;
+        return *this;
+    }
+
+    bit_iterator operator--(int)
+    {
+        bit_iterator tmp(*this);
+        --pos_;
+        return tmp;
+    }
+
+    bit_iterator& operator+=(difference_type n)
+    {
+        pos_ = static_cast<std::size_t>(static_cast<difference_type>(pos_) + n);
+        return *this;
+    }
+
+    bit_iterator& operator-=(difference_type n)
+    {
+        return *this += -n;
+    }
+
+    friend bit_iterator operator+(bit_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend bit_iterator operator+(difference_type n, bit_iterator it)
+    {
+        return it += n;
+    }
+
+    friend bit_iterator operator-(bit_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return (lhs.words_ - rhs.words_) * static_cast<difference_type>(__digits) +
+            (static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_));
+    }
+
+    friend bool operator==(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return lhs - rhs == 0;
+    }
+
+    friend bool operator!=(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return lhs - rhs < 0;
+    }
+
+    friend bool operator>(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const bit_iterator& lhs, const bit_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    bool dereference(std::true_type) const
+    {
+        return ((static_cast<std::uint64_t>(*words()) >> offset()) & 1u) != 0;
+    }
+
+    bit_reference<Word> dereference(std::false_type) const
+    {
+        return bit_reference<Word>(words(), offset());
+    }
+
+    Word* words_;
+    std::size_t pos_;
+};
+
+/** @brief Creates a bit_iterator to bit pos of the array of words. */
+template <class Word>
+inline bit_iterator<Word> make_bit_iterator(Word* words, std::size_t pos = 0)
+{
+    return bit_iterator<Word>(words, pos);
+}
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+/**
+ * @brief Gives the word and the bit offset of the bit iterators which the word-level overloads accept: bit_iterator
+ * and, with libstdc++, the iterators of std::vector<bool>.
+ */
+template <class Iterator>
+struct __bit_access : std::false_type {};
+
+template <class Word>
+struct __bit_access<stl_iterator::bit_iterator<Word>> : std::true_type
+{
+    static const typename std::remove_const<Word>::type* words(const stl_iterator::bit_iterator<Word>& it)
+    {
+        return it.words();
+    }
+
+    static unsigned offset(const stl_iterator::bit_iterator<Word>& it)
+    {
+        return it.offset();
+    }
+};
+
+#if (defined __GLIBCXX__) && !(defined _GLIBCXX_DEBUG)
+template <>
+struct __bit_access<std::_Bit_iterator> : std::true_type
+{
+    static const std::_Bit_type* words(const std::_Bit_iterator& it)
+    {
+        return it._M_p;
+    }
+
+    static unsigned offset(const std::_Bit_iterator& it)
+    {
+        return it._M_offset;
+    }
+};
+
+template <>
+struct __bit_access<std::_Bit_const_iterator> : std::true_type
+{
+    static const std::_Bit_type* words(const std::_Bit_const_iterator& it)
+    {
+        return it._M_p;
+    }
+
+    static unsigned offset(const std::_Bit_const_iterator& it)
+    {
+        return it._M_offset;
+    }
+};
+#endif
+
+template <class BitIt, class T>
+inline std::ptrdiff_t __bit_count(BitIt first, BitIt last, const T& value)
+{
+    const std::ptrdiff_t n = last - first;
+    const std::ptrdiff_t ones = static_cast<std::ptrdiff_t>(__count_bits(
+        __bit_access<BitIt>::words(first), __bit_access<BitIt>::offset(first), static_cast<std::size_t>(n)));
+    return (true == value ? ones : 0) + (false == value ? n - ones : 0);
+}
+
+/** @brief Returns the iterator to the first bit equal to value in [first, last), last if there is none. */
+template <class BitIt>
+inline BitIt __bit_find_value(BitIt first, BitIt last, bool value)
+{
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    const std::size_t found = __find_bit(
+        __bit_access<BitIt>::words(first), __bit_access<BitIt>::offset(first), n, value);
+    return first + static_cast<std::ptrdiff_t>(found);
+}
+
+template <class BitIt, class T>
+inline BitIt __bit_find(BitIt first, BitIt last, const T& value)
+{
+    const bool match_true = true == value;
+    const bool match_false = false == value;
+    if (match_true && match_false) {
+        return first;
+    }
+    if (!match_true && !match_false) {
+        return last;
+    }
+    return __bit_find_value(first, last, match_true);
+}
+
+/**
+ * @brief Checks if p returns true for at least one bit of [first, last).
+ *
+ * The predicate is applied to true and false once each, then the bits of the matching values are searched.
+ */
+template <class BitIt, class UnaryPredicate>
+inline bool __bit_any_of(BitIt first, BitIt last, UnaryPredicate& p)
+{
+    if (first == last) {
+        return false;
+    }
+    const bool match_true = static_cast<bool>(p(true));
+    const bool match_false = static_cast<bool>(p(false));
+    if (match_true == match_false) {
+        return match_true;
+    }
+    return __bit_find_value(first, last, match_true) != last;
+}
+
+template <class BitIt, class UnaryPredicate>
+inline bool __bit_all_of(BitIt first, BitIt last, UnaryPredicate& p)
+{
+    if (first == last) {
+        return true;
+    }
+    const bool match_true = static_cast<bool>(p(true));
+    const bool match_false = static_cast<bool>(p(false));
+    if (match_true == match_false) {
+        return match_true;
+    }
+    return __bit_find_value(first, last, !match_true) == last;
+}
+
+template <class BitIt1, class BitIt2>
+inline std::pair<BitIt1, BitIt2> __bit_mismatch(BitIt1 first1, BitIt1 last1, BitIt2 first2, std::true_type)
+{
+    const std::size_t found = __mismatch_bits(
+        __bit_access<BitIt1>::words(first1), __bit_access<BitIt1>::offset(first1),
+        __bit_access<BitIt2>::words(first2), __bit_access<BitIt2>::offset(first2),
+        static_cast<std::size_t>(last1 - first1));
+    return std::make_pair(first1 + static_cast<std::ptrdiff_t>(found), first2 + static_cast<std::ptrdiff_t>(found));
+}
+
+template <class BitIt1, class InputIt2>
+inline std::pair<BitIt1, InputIt2> __bit_mismatch(BitIt1 first1, BitIt1 last1, InputIt2 first2, std::false_type)
+{
+    return std::mismatch(first1, last1, first2);
+}
+
+template <class BitIt1, class InputIt2>
+inline std::pair<BitIt1, InputIt2> __bit_mismatch(BitIt1 first1, BitIt1 last1, InputIt2 first2)
+{
+    return __bit_mismatch(first1, last1, first2, __bit_access<InputIt2>());
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::count for bit_iterator, which counts the set bits with popcount, 64 bits at a
+ * time.
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class T>
+inline std::ptrdiff_t count(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last,
+    const T& value);
+#else // DOXYGEN_WORKING
+template <class Word, class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, const T& value)
+{
+    return __detail::__bit_count(first, last, value);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find for bit_iterator, which skips the words without the searched bit and finds
+ * it with count trailing zeros.
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class T>
+inline stl_iterator::bit_iterator<Word> find(stl_iterator::bit_iterator<Word> first,
+    stl_iterator::bit_iterator<Word> last, const T& value);
+#else // DOXYGEN_WORKING
+template <class Word, class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (stl_iterator::bit_iterator<Word>)
+    )
+inline find(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, const T& value)
+{
+    return __detail::__bit_find(first, last, value);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::all_of for bit_iterator.
+ *
+ * <p>
+ * The predicate is applied to true and false once each, then whole words are compared.
+ * </p>
+ * @see stl_algorithm::all_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class UnaryPredicate>
+inline bool all_of(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Word, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::bit_iterator<Word>>)),
+        // Return
+        (bool)
+    )
+inline all_of(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, UnaryPredicate p)
+{
+    return __detail::__bit_all_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for bit_iterator.
+ *
+ * <p>
+ * The predicate is applied to true and false once each, then whole words are compared.
+ * </p>
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class UnaryPredicate>
+inline bool any_of(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Word, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::bit_iterator<Word>>)),
+        // Return
+        (bool)
+    )
+inline any_of(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, UnaryPredicate p)
+{
+    return __detail::__bit_any_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::none_of for bit_iterator.
+ *
+ * <p>
+ * The predicate is applied to true and false once each, then whole words are compared.
+ * </p>
+ * @see stl_algorithm::none_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class UnaryPredicate>
+inline bool none_of(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Word, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::bit_iterator<Word>>)),
+        // Return
+        (bool)
+    )
+inline none_of(stl_iterator::bit_iterator<Word> first, stl_iterator::bit_iterator<Word> last, UnaryPredicate p)
+{
+    return !__detail::__bit_any_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::mismatch for bit_iterator, which compares 64 bits at a time with XOR when the
+ * second range is also a bit range, bit_iterator or std::vector<bool>.
+ * @see stl_algorithm::mismatch
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class InputIt2>
+inline std::pair<stl_iterator::bit_iterator<Word>, InputIt2> mismatch(stl_iterator::bit_iterator<Word> first1,
+    stl_iterator::bit_iterator<Word> last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class Word, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<bool, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<stl_iterator::bit_iterator<Word>, InputIt2>)
+    )
+inline mismatch(stl_iterator::bit_iterator<Word> first1, stl_iterator::bit_iterator<Word> last1, InputIt2 first2)
+{
+    return __detail::__bit_mismatch(first1, last1, first2);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::equal for bit_iterator, which compares 64 bits at a time with XOR when the
+ * second range is also a bit range, bit_iterator or std::vector<bool>.
+ * @see stl_algorithm::equal
+ */
+#ifdef DOXYGEN_WORKING
+template <class Word, class InputIt2>
+inline bool equal(stl_iterator::bit_iterator<Word> first1, stl_iterator::bit_iterator<Word> last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class Word, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::bit_iterator<Word>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<bool, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (bool)
+    )
+inline equal(stl_iterator::bit_iterator<Word> first1, stl_iterator::bit_iterator<Word> last1, InputIt2 first2)
+{
+    return __detail::__bit_mismatch(first1, last1, first2).first == last1;
+}
+#endif // DOXYGEN_WORKING
+
+#if (defined __GLIBCXX__) && !(defined _GLIBCXX_DEBUG)
+/**
+ * @brief Overloads of stl_algorithm::count, find, all_of, any_of, none_of, mismatch and equal for the iterators of
+ * std::vector<bool>, which work on whole words like the overloads for bit_iterator.
+ *
+ * <p>
+ * They read the words of the iterators of libstdc++, with other standard libraries and in the debug mode of libstdc++,
+ * whose checked iterators hide the words, the generic algorithms are used.
+ * </p>
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class T>
+inline std::ptrdiff_t count(std::vector<bool>::iterator first, std::vector<bool>::iterator last, const T& value);
+#else // DOXYGEN_WORKING
+template <class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(std::vector<bool>::iterator first, std::vector<bool>::iterator last, const T& value)
+{
+    return __detail::__bit_count(first, last, value);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::count */
+#ifdef DOXYGEN_WORKING
+template <class T>
+inline std::ptrdiff_t count(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last,
+    const T& value);
+#else // DOXYGEN_WORKING
+template <class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last, const T& value)
+{
+    return __detail::__bit_count(first, last, value);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::find */
+#ifdef DOXYGEN_WORKING
+template <class T>
+inline std::vector<bool>::iterator find(std::vector<bool>::iterator first, std::vector<bool>::iterator last,
+    const T& value);
+#else // DOXYGEN_WORKING
+template <class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (std::vector<bool>::iterator)
+    )
+inline find(std::vector<bool>::iterator first, std::vector<bool>::iterator last, const T& value)
+{
+    return __detail::__bit_find(first, last, value);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::find */
+#ifdef DOXYGEN_WORKING
+template <class T>
+inline std::vector<bool>::const_iterator find(std::vector<bool>::const_iterator first,
+    std::vector<bool>::const_iterator last, const T& value);
+#else // DOXYGEN_WORKING
+template <class T>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((stl_concept::EqualityComparableWith<bool, T>)),
+        // Return
+        (std::vector<bool>::const_iterator)
+    )
+inline find(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last, const T& value)
+{
+    return __detail::__bit_find(first, last, value);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::all_of */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool all_of(std::vector<bool>::iterator first, std::vector<bool>::iterator last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, std::vector<bool>::iterator>)),
+        // Return
+        (bool)
+    )
+inline all_of(std::vector<bool>::iterator first, std::vector<bool>::iterator last, UnaryPredicate p)
+{
+    return __detail::__bit_all_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::all_of */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool all_of(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, std::vector<bool>::const_iterator>)),
+        // Return
+        (bool)
+    )
+inline all_of(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last, UnaryPredicate p)
+{
+    return __detail::__bit_all_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::any_of */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool any_of(std::vector<bool>::iterator first, std::vector<bool>::iterator last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, std::vector<bool>::iterator>)),
+        // Return
+        (bool)
+    )
+inline any_of(std::vector<bool>::iterator first, std::vector<bool>::iterator last, UnaryPredicate p)
+{
+    return __detail::__bit_any_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::any_of */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool any_of(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, std::vector<bool>::const_iterator>)),
+        // Return
+        (bool)
+    )
+inline any_of(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last, UnaryPredicate p)
+{
+    return __detail::__bit_any_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::none_of */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool none_of(std::vector<bool>::iterator first, std::vector<bool>::iterator last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, std::vector<bool>::iterator>)),
+        // Return
+        (bool)
+    )
+inline none_of(std::vector<bool>::iterator first, std::vector<bool>::iterator last, UnaryPredicate p)
+{
+    return !__detail::__bit_any_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::none_of */
+#ifdef DOXYGEN_WORKING
+template <class UnaryPredicate>
+inline bool none_of(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, std::vector<bool>::const_iterator>)),
+        // Return
+        (bool)
+    )
+inline none_of(std::vector<bool>::const_iterator first, std::vector<bool>::const_iterator last, UnaryPredicate p)
+{
+    return !__detail::__bit_any_of(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::mismatch */
+#ifdef DOXYGEN_WORKING
+template <class InputIt2>
+inline std::pair<std::vector<bool>::iterator, InputIt2> mismatch(std::vector<bool>::iterator first1,
+    std::vector<bool>::iterator last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<bool, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<std::vector<bool>::iterator, InputIt2>)
+    )
+inline mismatch(std::vector<bool>::iterator first1, std::vector<bool>::iterator last1, InputIt2 first2)
+{
+    return __detail::__bit_mismatch(first1, last1, first2);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::mismatch */
+#ifdef DOXYGEN_WORKING
+template <class InputIt2>
+inline std::pair<std::vector<bool>::const_iterator, InputIt2> mismatch(std::vector<bool>::const_iterator first1,
+    std::vector<bool>::const_iterator last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<bool, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<std::vector<bool>::const_iterator, InputIt2>)
+    )
+inline mismatch(std::vector<bool>::const_iterator first1, std::vector<bool>::const_iterator last1, InputIt2 first2)
+{
+    return __detail::__bit_mismatch(first1, last1, first2);
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::equal */
+#ifdef DOXYGEN_WORKING
+template <class InputIt2>
+inline bool equal(std::vector<bool>::iterator first1, std::vector<bool>::iterator last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::iterator>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<bool, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (bool)
+    )
+inline equal(std::vector<bool>::iterator first1, std::vector<bool>::iterator last1, InputIt2 first2)
+{
+    return __detail::__bit_mismatch(first1, last1, first2).first == last1;
+}
+#endif // DOXYGEN_WORKING
+
+/** @see stl_algorithm::equal */
+#ifdef DOXYGEN_WORKING
+template <class InputIt2>
+inline bool equal(std::vector<bool>::const_iterator first1, std::vector<bool>::const_iterator last1,
+    InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<std::vector<bool>::const_iterator>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<bool, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (bool)
+    )
+inline equal(std::vector<bool>::const_iterator first1, std::vector<bool>::const_iterator last1, InputIt2 first2)
+{
+    return __detail::__bit_mismatch(first1, last1, first2).first == last1;
+}
+#endif // DOXYGEN_WORKING
+#endif // __GLIBCXX__
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_BIT_ITERATOR_HPP__
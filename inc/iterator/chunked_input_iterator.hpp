@@ -0,0 +1,615 @@
+/** @file */
+#ifndef __STL_ITERATOR_CHUNKED_INPUT_ITERATOR_HPP__
+#define __STL_ITERATOR_CHUNKED_INPUT_ITERATOR_HPP__
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <istream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+#if (defined __unix__) || (defined __APPLE__)
+#include <unistd.h>
+#define __STL_ITERATOR_HAS_FD_INPUT 1
+#else
+#define __STL_ITERATOR_HAS_FD_INPUT 0
+#endif
+
+namespace stl_iterator {
+
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Buffer shared by the copies of a chunked_input_iterator.
+ *
+ * The source is read a chunk at a time into the buffer, which is refilled only when its last element was consumed.
+ * Derived classes implement the reading of the source.
+ */
+template <class CharT>
+class __chunk_buffer
+{
+public:
+    explicit __chunk_buffer(std::size_t chunk_size)
+        : data_(chunk_size == 0 ? 1 : chunk_size)
+        , position_(data_.data())
+        , end_(data_.data())
+        , eof_(false)
+    {}
+
+    virtual ~__chunk_buffer() = default;
+
+    const CharT* position() const
+    {
+        return position_;
+    }
+
+    const CharT* end() const
+    {
+        return end_;
+    }
+
+    void seek(const CharT* p)
+    {
+        position_ = p;
+    }
+
+    /** @brief Returns true if the source is exhausted, refilling the buffer if the current chunk is consumed. */
+    bool exhausted()
+    {
+        while (position_ == end_ && !eof_) {
+            const std::size_t n = read(data_.data(), data_.size());
+            position_ = data_.data();
+            end_ = position_ + n;
+            eof_ = (n == 0);
+        }
+        return position_ == end_;
+    }
+
+private:
+    /** @brief Stores at most n characters of the source in buffer, returns their number or 0 at the end. */
+    virtual std::size_t read(CharT* buffer, std::size_t n) = 0;
+
+    std::vector<CharT> data_;
+    const CharT* position_;
+    const CharT* end_;
+    bool eof_;
+};
+
+/** @brief Chunk buffer reading a stream buffer. */
+template <class CharT, class Traits>
+class __streambuf_chunk_buffer : public __chunk_buffer<CharT>
+{
+public:
+    __streambuf_chunk_buffer(std::basic_streambuf<CharT, Traits>* sb, std::size_t chunk_size)
+        : __chunk_buffer<CharT>(chunk_size)
+        , sb_(sb)
+    {}
+
+private:
+    std::size_t read(CharT* buffer, std::size_t n) override
+    {
+        const std::streamsize count = sb_->sgetn(buffer, static_cast<std::streamsize>(n));
+        return count > 0 ? static_cast<std::size_t>(count) : 0;
+    }
+
+    std::basic_streambuf<CharT, Traits>* sb_;
+};
+
+#if __STL_ITERATOR_HAS_FD_INPUT
+/** @brief Chunk buffer reading a file descriptor, retrying reads on interruption. */
+class __fd_chunk_buffer : public __chunk_buffer<char>
+{
+public:
+    __fd_chunk_buffer(int fd, std::size_t chunk_size)
+        : __chunk_buffer<char>(chunk_size)
+        , fd_(fd)
+    {}
+
+private:
+    std::size_t read(char* buffer, std::size_t n) override
+    {
+        for (;;) {
+            const ::ssize_t count = ::read(fd_, buffer, n);
+            if (count >= 0) {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "read");
+            }
+        }
+    }
+
+    int fd_;
+};
+#endif // __STL_ITERATOR_HAS_FD_INPUT
+/// @endcond
+
+} // namespace __detail
+
+/**
+ * @brief Input iterator which reads a stream buffer or a file descriptor by large chunks.
+ *
+ * <p>
+ * Reading through std::istreambuf_iterator costs a stream buffer call per character. This iterator reads a whole
+ * chunk at once and exposes it as a contiguous array, so that stl_algorithm::find, count, mismatch and equal run
+ * their loops over the array and only cross to the source when a chunk is consumed.<br/>
+ * Like std::istreambuf_iterator, all the copies of an iterator share the position in the stream, and two iterators
+ * compare equal if and only if both or neither are at the end of the stream.<br/>
+ * The source is consumed by whole chunks, the characters read ahead stay in the buffer of the iterator.
+ * </p>
+ * @tparam CharT - character type
+ * @tparam Traits - character traits
+ */
+template <class CharT, class Traits = std::char_traits<CharT>>
+class chunked_input_iterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = CharT;
+    using reference = const CharT&;
+    using pointer = const CharT*;
+    using difference_type = std::ptrdiff_t;
+    using traits_type = Traits;
+    using streambuf_type = std::basic_streambuf<CharT, Traits>;
+    using istream_type = std::basic_istream<CharT, Traits>;
+
+    /** @brief Default size of a chunk, in characters. */
+    static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+    /** @brief Constructs the end-of-stream iterator. */
+    chunked_input_iterator() = default;
+
+    /**
+     * @param sb - stream buffer to read, which must outlive the iterator
+     * @param chunk_size - number of characters read at once
+     */
+    explicit chunked_input_iterator(streambuf_type* sb, std::size_t chunk_size = default_chunk_size)
+        : buffer_()
+    {
+        if (sb != nullptr) {
+            buffer_ = std::make_shared<__detail::__streambuf_chunk_buffer<CharT, Traits>>(sb, chunk_size);
+        }
+    }
+
+    /**
+     * @param is - stream to read, which must outlive the iterator
+     * @param chunk_size - number of characters read at once
+     */
+    explicit chunked_input_iterator(istream_type& is, std::size_t chunk_size = default_chunk_size)
+        : chunked_input_iterator(is.rdbuf(), chunk_size)
+    {}
+
+    /**
+     * @brief Constructs an iterator reading the chunks of buffer.
+     *
+     * It is the extension point for sources other than stream buffers, such as file descriptors.
+     */
+    explicit chunked_input_iterator(std::shared_ptr<__detail::__chunk_buffer<CharT>> buffer)
+        : buffer_(std::move(buffer))
+    {}
+
+    /**
+     * @brief Returns the pointer to the current character in the current chunk.
+     *
+     * [chunk_begin(), chunk_end()) is the part of the chunk not yet consumed, it is empty at the end of the stream.
+     */
+    pointer chunk_begin() const
+    {
+        return at_end() ? nullptr : buffer_->position();
+    }
+
+    /** @brief Returns the pointer past the last character of the current chunk. */
+    pointer chunk_end() const
+    {
+        return at_end() ? nullptr : buffer_->end();
+    }
+
+    /**
+     * @brief Moves the iterator to the position p of the current chunk.
+     * @param p - pointer in [chunk_begin(), chunk_end()]
+     */
+    chunked_input_iterator& seek(pointer p)
+    {
+        buffer_->seek(p);
+        return *this;
+    }
+
+    reference operator*() const
+    {
+        return *chunk_begin();
+    }
+
+    pointer operator->() const
+    {
+        return chunk_begin();
+    }
+
+    chunked_input_iterator& operator++()
+    {
+        return seek(chunk_begin() + 1);
+    }
+
+    /** @brief Keeps a copy of the current character, so that *it++ is the character before the increment. */
+    class postfix_proxy
+    {
+    public:
+        explicit postfix_proxy(CharT value)
+            : value_(value)
+        {}
+
+        const CharT& operator*() const
+        {
+            return value_;
+        }
+
+    private:
+        CharT value_;
+    };
+
+    postfix_proxy operator++(int)
+    {
+        postfix_proxy tmp(**this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const chunked_input_iterator& lhs, const chunked_input_iterator& rhs)
+    {
+        return lhs.at_end() == rhs.at_end();
+    }
+
+    friend bool operator!=(const chunked_input_iterator& lhs, const chunked_input_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    bool at_end() const
+    {
+        return !buffer_ || buffer_->exhausted();
+    }
+
+    std::shared_ptr<__detail::__chunk_buffer<CharT>> buffer_;
+};
+
+template <class CharT, class Traits>
+constexpr std::size_t chunked_input_iterator<CharT, Traits>::default_chunk_size;
+
+/**
+ * @brief Creates a chunked_input_iterator reading the stream is.
+ * @param is - stream to read, which must outlive the iterator
+ * @param chunk_size - number of characters read at once
+ */
+template <class CharT, class Traits>
+inline chunked_input_iterator<CharT, Traits> make_chunked_input_iterator(
+    std::basic_istream<CharT, Traits>& is,
+    std::size_t chunk_size = chunked_input_iterator<CharT, Traits>::default_chunk_size)
+{
+    return chunked_input_iterator<CharT, Traits>(is, chunk_size);
+}
+
+#if __STL_ITERATOR_HAS_FD_INPUT
+/**
+ * @brief Creates a chunked_input_iterator reading the file descriptor fd with read(2).
+ *
+ * <p>
+ * The file descriptor is not closed by the iterator. A read error throws std::system_error.
+ * </p>
+ * @param fd - open file descriptor, such as STDIN_FILENO
+ * @param chunk_size - number of bytes read at once
+ */
+inline chunked_input_iterator<char> make_fd_input_iterator(
+    int fd,
+    std::size_t chunk_size = chunked_input_iterator<char>::default_chunk_size)
+{
+    return chunked_input_iterator<char>(std::make_shared<__detail::__fd_chunk_buffer>(fd, chunk_size));
+}
+#endif // __STL_ITERATOR_HAS_FD_INPUT
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Finds the first element of the contiguous array [first, last) equal to value. */
+template <class T, class U>
+inline const T* __chunk_find(const T* first, const T* last, const U& value)
+{
+    return std::find(first, last, value);
+}
+
+inline const char* __chunk_find(const char* first, const char* last, char value)
+{
+    const char* found = std::char_traits<char>::find(first, static_cast<std::size_t>(last - first), value);
+    return found == nullptr ? last : found;
+}
+
+/**
+ * @brief Compares the chunks of first1 with the elements from first2 until a mismatch or the end of first1.
+ * @return true if a mismatch was found
+ */
+template <class CharT, class Traits, class InputIt2>
+inline bool __chunked_mismatch(stl_iterator::chunked_input_iterator<CharT, Traits>& first1, InputIt2& first2)
+{
+    const stl_iterator::chunked_input_iterator<CharT, Traits> last1;
+    while (first1 != last1) {
+        const CharT* chunk_end = first1.chunk_end();
+        const auto found = std::mismatch(first1.chunk_begin(), chunk_end, first2);
+        first1.seek(found.first);
+        first2 = found.second;
+        if (found.first != chunk_end) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** @brief Compares two chunked ranges by the overlapping parts of their current chunks. */
+template <class CharT, class Traits>
+inline bool __chunked_mismatch(
+    stl_iterator::chunked_input_iterator<CharT, Traits>& first1,
+    stl_iterator::chunked_input_iterator<CharT, Traits>& first2)
+{
+    const stl_iterator::chunked_input_iterator<CharT, Traits> last;
+    while (first1 != last && first2 != last) {
+        const std::ptrdiff_t n = std::min(
+            first1.chunk_end() - first1.chunk_begin(),
+            first2.chunk_end() - first2.chunk_begin());
+        const auto found = std::mismatch(first1.chunk_begin(), first1.chunk_begin() + n, first2.chunk_begin());
+        const bool mismatch = (found.first != first1.chunk_begin() + n);
+        first1.seek(found.first);
+        first2.seek(found.second);
+        if (mismatch) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::find for chunked_input_iterator ranges.
+ *
+ * <p>
+ * Each chunk is searched as a contiguous array.
+ * </p>
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class CharT, class Traits, class U>
+inline stl_iterator::chunked_input_iterator<CharT, Traits> find(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class CharT, class Traits, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::chunked_input_iterator<CharT, Traits>>))
+        ((stl_concept::EqualityComparableWith<CharT, U>)),
+        // Return
+        (stl_iterator::chunked_input_iterator<CharT, Traits>)
+    )
+inline find(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    const U& value)
+{
+    while (first != last) {
+        const CharT* found = __detail::__chunk_find(first.chunk_begin(), first.chunk_end(), value);
+        const bool in_chunk = (found != first.chunk_end());
+        first.seek(found);
+        if (in_chunk) {
+            break;
+        }
+    }
+    return first;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if for chunked_input_iterator ranges.
+ *
+ * <p>
+ * Each chunk is searched as a contiguous array.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class CharT, class Traits, class UnaryPredicate>
+inline stl_iterator::chunked_input_iterator<CharT, Traits> find_if(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class CharT, class Traits, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::chunked_input_iterator<CharT, Traits>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::chunked_input_iterator<CharT, Traits>>)),
+        // Return
+        (stl_iterator::chunked_input_iterator<CharT, Traits>)
+    )
+inline find_if(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    UnaryPredicate p)
+{
+    while (first != last) {
+        const CharT* found = std::find_if(first.chunk_begin(), first.chunk_end(), std::ref(p));
+        const bool in_chunk = (found != first.chunk_end());
+        first.seek(found);
+        if (in_chunk) {
+            break;
+        }
+    }
+    return first;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count for chunked_input_iterator ranges.
+ *
+ * <p>
+ * Each chunk is counted as a contiguous array.
+ * </p>
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class CharT, class Traits, class U>
+inline std::ptrdiff_t count(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class CharT, class Traits, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::chunked_input_iterator<CharT, Traits>>))
+        ((stl_concept::EqualityComparableWith<CharT, U>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    const U& value)
+{
+    std::ptrdiff_t n = 0;
+    while (first != last) {
+        n += std::count(first.chunk_begin(), first.chunk_end(), value);
+        first.seek(first.chunk_end());
+    }
+    return n;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for chunked_input_iterator ranges.
+ *
+ * <p>
+ * Each chunk is counted as a contiguous array.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class CharT, class Traits, class UnaryPredicate>
+inline std::ptrdiff_t count_if(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class CharT, class Traits, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::chunked_input_iterator<CharT, Traits>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::chunked_input_iterator<CharT, Traits>>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count_if(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last,
+    UnaryPredicate p)
+{
+    std::ptrdiff_t n = 0;
+    while (first != last) {
+        n += std::count_if(first.chunk_begin(), first.chunk_end(), std::ref(p));
+        first.seek(first.chunk_end());
+    }
+    return n;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::mismatch for a chunked_input_iterator first range.
+ *
+ * <p>
+ * Each chunk of the first range is compared as a contiguous array. When the second range is also a
+ * chunked_input_iterator range, the overlapping parts of the two current chunks are compared at once.
+ * </p>
+ * @see stl_algorithm::mismatch
+ */
+#ifdef DOXYGEN_WORKING
+template <class CharT, class Traits, class InputIt2>
+inline auto mismatch(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first1,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last1,
+    InputIt2 first2)
+    -> decltype(std::pair<stl_iterator::chunked_input_iterator<CharT, Traits>, InputIt2>);
+#else // DOXYGEN_WORKING
+template <class CharT, class Traits, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::chunked_input_iterator<CharT, Traits>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<CharT, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<stl_iterator::chunked_input_iterator<CharT, Traits>, InputIt2>)
+    )
+inline mismatch(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first1,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last1,
+    InputIt2 first2)
+{
+    if (first1 != last1) {
+        __detail::__chunked_mismatch(first1, first2);
+    }
+    return std::make_pair(first1, first2);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::equal for a chunked_input_iterator first range.
+ *
+ * <p>
+ * Each chunk of the first range is compared as a contiguous array. When the second range is also a
+ * chunked_input_iterator range, the overlapping parts of the two current chunks are compared at once.
+ * </p>
+ * @see stl_algorithm::equal
+ */
+#ifdef DOXYGEN_WORKING
+template <class CharT, class Traits, class InputIt2>
+inline bool equal(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first1,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last1,
+    InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class CharT, class Traits, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::chunked_input_iterator<CharT, Traits>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<CharT, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (bool)
+    )
+inline equal(
+    stl_iterator::chunked_input_iterator<CharT, Traits> first1,
+    stl_iterator::chunked_input_iterator<CharT, Traits> last1,
+    InputIt2 first2)
+{
+    return first1 == last1 || !__detail::__chunked_mismatch(first1, first2);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_CHUNKED_INPUT_ITERATOR_HPP__
@@ -0,0 +1,83 @@
+/** @file */
+#ifndef __STL_ITERATOR_DETAIL_FUNCTION_BOX_HPP__
+#define __STL_ITERATOR_DETAIL_FUNCTION_BOX_HPP__
+
+#include <new>
+#include <type_traits>
+
+namespace stl_iterator {
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Holder which makes a function object default constructible and copy assignable.
+ *
+ * <p>
+ * Iterators must meet the requirements of <i>stl_concept::CopyAssignable</i>, but function objects such as lambdas are
+ * not assignable. The holder implements assignment by destroying and copy constructing the held object.
+ * </p>
+ * @tparam F - function object type, must meet the requirements of <i>stl_concept::CopyConstructible</i>
+ */
+template <class F>
+class __function_box
+{
+public:
+    __function_box()
+        : engaged_(false)
+    {}
+
+    explicit __function_box(const F& f)
+        : engaged_(true)
+    {
+        ::new (static_cast<void*>(&storage_)) F(f);
+    }
+
+    __function_box(const __function_box& other)
+        : engaged_(other.engaged_)
+    {
+        if (engaged_) {
+            ::new (static_cast<void*>(&storage_)) F(other.get());
+        }
+    }
+
+    __function_box& operator=(const __function_box& other)
+    {
+        if (this != &other) {
+            reset();
+            if (other.engaged_) {
+                ::new (static_cast<void*>(&storage_)) F(other.get());
+                engaged_ = true;
+            }
+        }
+        return *this;
+    }
+
+    ~__function_box()
+    {
+        reset();
+    }
+
+    /** @brief Returns the held function object, the behavior is undefined if nothing is held. */
+    F& get() const
+    {
+        return *reinterpret_cast<F*>(&storage_);
+    }
+
+private:
+    void reset()
+    {
+        if (engaged_) {
+            get().~F();
+            engaged_ = false;
+        }
+    }
+
+    mutable typename std::aligned_storage<sizeof(F), alignof(F)>::type storage_;
+    bool engaged_;
+};
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_DETAIL_FUNCTION_BOX_HPP__
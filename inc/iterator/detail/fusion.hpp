@@ -0,0 +1,131 @@
+/** @file */
+#ifndef __STL_ITERATOR_DETAIL_FUSION_HPP__
+#define __STL_ITERATOR_DETAIL_FUSION_HPP__
+
+#include <algorithm>
+#include <utility>
+#include "iterator/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Predicate which returns q(x) && p(x).
+ */
+template <class Q, class P>
+struct __and_predicate
+{
+    Q q;
+    P p;
+
+    template <class T>
+    bool operator()(T&& x)
+    {
+        return q(x) && p(x);
+    }
+};
+
+/**
+ * @brief Predicate which returns !p(x).
+ */
+template <class P>
+struct __not_predicate
+{
+    P p;
+
+    template <class T>
+    bool operator()(T&& x)
+    {
+        return !p(std::forward<T>(x));
+    }
+};
+
+/**
+ * @brief Function object which returns p(f(x)).
+ */
+template <class P, class F>
+struct __composed_function
+{
+    P p;
+    F f;
+
+    template <class T>
+    auto operator()(T&& x) -> decltype(std::declval<P&>()(std::declval<F&>()(std::forward<T>(x))))
+    {
+        return p(f(std::forward<T>(x)));
+    }
+};
+
+/**
+ * @brief Describes how a lazy view iterator is flattened onto the iterator it adapts.
+ *
+ * <p>
+ * A view iterator specializes this template to provide
+ * <ul style="list-style-type:disc">
+ *   <li>base_iterator, the innermost iterator type</li>
+ *   <li>base(it), the innermost iterator of it</li>
+ *   <li>predicate(it, p), a predicate on the innermost elements equivalent to p on the elements of it</li>
+ *   <li>rebind(it, b), the view iterator of the same view as it positioned at the innermost iterator b</li>
+ * </ul>
+ * so that the algorithms run a single loop over the innermost range instead of stacked iterator adapters.<br/>
+ * The primary template describes an iterator which is not a view.
+ * </p>
+ * @tparam Iterator - iterator type
+ */
+template <class Iterator>
+struct __fusion
+{
+    using base_iterator = Iterator;
+
+    static base_iterator base(const Iterator& it)
+    {
+        return it;
+    }
+
+    template <class Predicate>
+    static Predicate predicate(const Iterator&, Predicate p)
+    {
+        return p;
+    }
+
+    static Iterator rebind(const Iterator&, base_iterator b)
+    {
+        return b;
+    }
+};
+
+/** @brief Runs find_if on the innermost range of a view. */
+template <class Iterator, class Predicate>
+inline Iterator __fused_find_if(Iterator first, Iterator last, Predicate p)
+{
+    using __Fusion = __fusion<Iterator>;
+    return __Fusion::rebind(first, std::find_if(
+        __Fusion::base(first),
+        __Fusion::base(last),
+        __Fusion::predicate(first, std::move(p))));
+}
+
+/** @brief Runs count_if on the innermost range of a view. */
+template <class Iterator, class Predicate>
+inline __iterator_difference_t<Iterator> __fused_count_if(Iterator first, Iterator last, Predicate p)
+{
+    using __Fusion = __fusion<Iterator>;
+    return static_cast<__iterator_difference_t<Iterator>>(std::count_if(
+        __Fusion::base(first),
+        __Fusion::base(last),
+        __Fusion::predicate(first, std::move(p))));
+}
+
+/** @brief Runs find_if_not on the innermost range of a view. */
+template <class Iterator, class Predicate>
+inline Iterator __fused_find_if_not(Iterator first, Iterator last, Predicate p)
+{
+    return __fused_find_if(first, last, __not_predicate<Predicate>{std::move(p)});
+}
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_DETAIL_FUSION_HPP__
@@ -0,0 +1,47 @@
+/** @file */
+#ifndef __STL_ITERATOR_DETAIL_INDEX_SEQUENCE_HPP__
+#define __STL_ITERATOR_DETAIL_INDEX_SEQUENCE_HPP__
+
+#include <cstddef>
+
+namespace stl_iterator {
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Compile-time sequence of indices, equivalent to C++14 std::index_sequence.
+ * @tparam I - indices
+ * @see https://en.cppreference.com/w/cpp/utility/integer_sequence
+ */
+template <std::size_t... I>
+struct __index_sequence {};
+
+template <std::size_t N, std::size_t... I>
+struct __make_index_sequence_impl
+    : __make_index_sequence_impl<N - 1, N - 1, I...> {};
+
+template <std::size_t... I>
+struct __make_index_sequence_impl<0, I...>
+{
+    using type = __index_sequence<I...>;
+};
+
+/**
+ * @brief Helper alias of __index_sequence<0, 1, ..., N - 1>, equivalent to C++14 std::make_index_sequence.
+ * @tparam N - number of indices
+ */
+template <std::size_t N>
+using __make_index_sequence = typename __make_index_sequence_impl<N>::type;
+
+/**
+ * @brief Helper alias of __index_sequence<0, 1, ..., sizeof...(T) - 1>, equivalent to C++14 std::index_sequence_for.
+ * @tparam T - types to be indexed
+ */
+template <class... T>
+using __index_sequence_for = __make_index_sequence<sizeof...(T)>;
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_DETAIL_INDEX_SEQUENCE_HPP__
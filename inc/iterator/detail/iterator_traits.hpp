@@ -0,0 +1,44 @@
+/** @file */
+#ifndef __STL_ITERATOR_DETAIL_ITERATOR_TRAITS_HPP__
+#define __STL_ITERATOR_DETAIL_ITERATOR_TRAITS_HPP__
+
+#include <type_traits>
+#include "concept/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+namespace __detail {
+
+/// @cond DEV
+/** @brief Alias of stl_concept::__detail::__iterator_category_t */
+template <class Iterator>
+using __iterator_category_t = stl_concept::__detail::__iterator_category_t<Iterator>;
+
+/** @brief Alias of stl_concept::__detail::__iterator_difference_t */
+template <class Iterator>
+using __iterator_difference_t = stl_concept::__detail::__iterator_difference_t<Iterator>;
+
+/** @brief Alias of stl_concept::__detail::__iterator_pointer_t */
+template <class Iterator>
+using __iterator_pointer_t = stl_concept::__detail::__iterator_pointer_t<Iterator>;
+
+/** @brief Alias of stl_concept::__detail::__iterator_reference_t */
+template <class Iterator>
+using __iterator_reference_t = stl_concept::__detail::__iterator_reference_t<Iterator>;
+
+/** @brief Alias of stl_concept::__detail::__iterator_value_t */
+template <class Iterator>
+using __iterator_value_t = stl_concept::__detail::__iterator_value_t<Iterator>;
+
+/**
+ * @brief Checks if the category of Iterator is derived from Category.
+ * @tparam Iterator - iterator type
+ * @tparam Category - iterator category tag
+ */
+template <class Iterator, class Category>
+using __has_iterator_category = std::is_base_of<Category, __iterator_category_t<Iterator>>;
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_DETAIL_ITERATOR_TRAITS_HPP__
@@ -0,0 +1,549 @@
+/** @file */
+#ifndef __STL_ITERATOR_DICTIONARY_RANGE_HPP__
+#define __STL_ITERATOR_DICTIONARY_RANGE_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/copy_constructible.hpp"
+#include "concept/equality_comparable.hpp"
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "concept/unsigned_integral.hpp"
+#include "algorithm/detail/code_kernel.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/lane_kernel.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_iterator {
+
+template <class T, class Code>
+class dictionary_range;
+
+/**
+ * @brief Random access iterator over the elements of a dictionary_range, dereferenced to the dictionary entry of its
+ * code.
+ * @tparam T - value type
+ * @tparam Code - code type
+ */
+template <class T, class Code>
+class dictionary_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using reference = const T&;
+    using pointer = const T*;
+    using difference_type = std::ptrdiff_t;
+
+    dictionary_iterator()
+        : range_(nullptr)
+        , code_(nullptr)
+    {}
+
+    dictionary_iterator(const dictionary_range<T, Code>* range, const Code* code)
+        : range_(range)
+        , code_(code)
+    {}
+
+    /** @brief Returns the range of the element. */
+    const dictionary_range<T, Code>* range() const
+    {
+        return range_;
+    }
+
+    /** @brief Returns the pointer to the code of the element. */
+    const Code* base() const
+    {
+        return code_;
+    }
+
+    reference operator*() const
+    {
+        return range_->dictionary()[*code_];
+    }
+
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return range_->dictionary()[code_[n]];
+    }
+
+    dictionary_iterator& operator++()
+    {
+        ++code_;
+        return *this;
+    }
+
+    dictionary_iterator operator++(int)
+    {
+        dictionary_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    dictionary_iterator& operator--()
+    {
+        --code_;
+        return *this;
+    }
+
+    dictionary_iterator operator--(int)
+    {
+        dictionary_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    dictionary_iterator& operator+=(difference_type n)
+    {
+        code_ += n;
+        return *this;
+    }
+
+    dictionary_iterator& operator-=(difference_type n)
+    {
+        code_ -= n;
+        return *this;
+    }
+
+    friend dictionary_iterator operator+(dictionary_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend dictionary_iterator operator+(difference_type n, dictionary_iterator it)
+    {
+        return it += n;
+    }
+
+    friend dictionary_iterator operator-(dictionary_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return lhs.code_ - rhs.code_;
+    }
+
+    friend bool operator==(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return lhs.code_ == rhs.code_;
+    }
+
+    friend bool operator!=(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return lhs.code_ < rhs.code_;
+    }
+
+    friend bool operator>(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const dictionary_iterator& lhs, const dictionary_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    const dictionary_range<T, Code>* range_;
+    const Code* code_;
+};
+
+/**
+ * @brief Immutable sequence stored as a dictionary of its distinct values and one narrow integer code per element.
+ *
+ * <p>
+ * It is meant for columns with few distinct values, such as strings taken from a small set: the dictionary is searched
+ * linearly while the range is built.<br/>
+ * stl_algorithm::find, count, count_if and equal over its iterators apply the value comparison or the predicate once
+ * per dictionary entry, then scan the codes, 32 at a time, with integer comparisons (AVX2 byte comparisons when
+ * available for std::uint8_t codes).
+ * </p>
+ * ```
+ * stl_iterator::dictionary_range<std::string> column(names.begin(), names.end());
+ * auto n = stl_algorithm::count(column.begin(), column.end(), std::string("pending"));
+ * ```
+ * @tparam T - must meet the requirements of <i>stl_concept::CopyConstructible</i> and
+ * <i>stl_concept::EqualityComparable</i>.
+ * @tparam Code - must meet the requirements of <i>stl_concept::UnsignedIntegral</i>, it limits the number of distinct
+ * values.
+ */
+template <class T, class Code = std::uint8_t>
+class dictionary_range
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyConstructible<T>));
+    BOOST_CONCEPT_ASSERT((stl_concept::EqualityComparable<T>));
+    BOOST_CONCEPT_ASSERT((stl_concept::UnsignedIntegral<Code>));
+
+public:
+    using value_type = T;
+    using code_type = Code;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = dictionary_iterator<T, Code>;
+    using iterator = const_iterator;
+
+    dictionary_range() = default;
+
+    /**
+     * @brief Encodes the elements of [first, last).
+     * @throw std::length_error if there are more distinct values than codes
+     */
+    template <class InputIt>
+    dictionary_range(InputIt first, InputIt last)
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<InputIt>));
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    dictionary_range(std::initializer_list<T> init)
+        : dictionary_range(init.begin(), init.end())
+    {}
+
+    /**
+     * @brief Appends value, adding it to the dictionary if it is not there yet.
+     * @throw std::length_error if there are more distinct values than codes
+     */
+    void push_back(const T& value)
+    {
+        size_type code = codes_.empty() ? 0 : codes_.back();
+        if (code >= dictionary_.size() || !(dictionary_[code] == value)) {
+            const auto found = std::find(dictionary_.begin(), dictionary_.end(), value);
+            code = static_cast<size_type>(found - dictionary_.begin());
+        }
+        if (code == dictionary_.size()) {
+            if (code > std::numeric_limits<Code>::max()) {
+                throw std::length_error("stl_iterator::dictionary_range::push_back");
+            }
+            dictionary_.push_back(value);
+        }
+        codes_.push_back(static_cast<Code>(code));
+    }
+
+    size_type size() const
+    {
+        return codes_.size();
+    }
+
+    bool empty() const
+    {
+        return codes_.empty();
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, codes_.data());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, codes_.data() + codes_.size());
+    }
+
+    const T& operator[](size_type pos) const
+    {
+        return dictionary_[codes_[pos]];
+    }
+
+    /** @brief Returns the distinct values, in the order of their first occurrence. */
+    const std::vector<T>& dictionary() const
+    {
+        return dictionary_;
+    }
+
+    /** @brief Returns the code of each element, which is the index of its value in the dictionary. */
+    const std::vector<Code>& codes() const
+    {
+        return codes_;
+    }
+
+private:
+    std::vector<T> dictionary_;
+    std::vector<Code> codes_;
+};
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+/**
+ * @brief Applies p to each dictionary entry of the range of first, then returns the result of scan for the codes of
+ * [first, last), given either the only matching code or the table of the matching codes.
+ * @param none - result when no entry matches
+ * @param all - result when every entry matches
+ */
+template <class T, class Code, class Predicate, class Scan>
+inline std::size_t __dictionary_scan(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    Predicate& p,
+    Scan scan,
+    std::size_t none,
+    std::size_t all)
+{
+    if (first == last) {
+        return none;
+    }
+    const std::vector<T>& dictionary = first.range()->dictionary();
+    // The table of a dictionary of at most 256 entries, as all those of 8-bit codes, is not allocated. Larger
+    // dictionaries evaluate p so many times that the allocation does not matter.
+    bool local[256];
+    std::unique_ptr<bool[]> allocated;
+    bool* table = local;
+    if (dictionary.size() > sizeof(local) / sizeof(local[0])) {
+        allocated.reset(new bool[dictionary.size()]);
+        table = allocated.get();
+    }
+    std::fill_n(table, dictionary.size(), false);
+    std::size_t matches = 0;
+    Code code = 0;
+    for (std::size_t i = 0; i < dictionary.size(); ++i) {
+        if (p(dictionary[i])) {
+            table[i] = true;
+            code = static_cast<Code>(i);
+            ++matches;
+        }
+    }
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (matches == 0) {
+        return none;
+    }
+    if (matches == dictionary.size()) {
+        return all;
+    }
+    return matches == 1 ? scan(first.base(), n, code) : scan(first.base(), n, static_cast<const bool*>(table));
+}
+
+struct __code_count_scan
+{
+    template <class Code, class Key>
+    std::size_t operator()(const Code* p, std::size_t n, Key key) const
+    {
+        return __code_count(p, n, key);
+    }
+};
+
+struct __code_find_scan
+{
+    template <class Code, class Key>
+    std::size_t operator()(const Code* p, std::size_t n, Key key) const
+    {
+        return __code_find(p, n, key);
+    }
+};
+
+template <class T, class Code, class U, class Code2>
+inline bool __dictionary_equal(
+    stl_iterator::dictionary_iterator<T, Code> first1,
+    stl_iterator::dictionary_iterator<T, Code> last1,
+    stl_iterator::dictionary_iterator<U, Code2> first2,
+    std::true_type)
+{
+    if (first1 == last1) {
+        return true;
+    }
+    const std::size_t n = static_cast<std::size_t>(last1 - first1);
+    if (static_cast<const void*>(first1.range()) == static_cast<const void*>(first2.range())) {
+        return std::equal(first1.base(), first1.base() + n, first2.base());
+    }
+    // Translates each entry of the first dictionary to the code of its value in the second one, or to a code which is
+    // not used when the value is absent.
+    const std::vector<T>& dictionary1 = first1.range()->dictionary();
+    const std::vector<U>& dictionary2 = first2.range()->dictionary();
+    std::vector<std::size_t> translation(dictionary1.size());
+    for (std::size_t i = 0; i < dictionary1.size(); ++i) {
+        std::size_t j = 0;
+        while (j < dictionary2.size() && !(dictionary1[i] == dictionary2[j])) {
+            ++j;
+        }
+        translation[i] = j;
+    }
+    const Code* codes1 = first1.base();
+    const Code2* codes2 = first2.base();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (translation[codes1[i]] != codes2[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class T, class Code, class InputIt2>
+inline bool __dictionary_equal(
+    stl_iterator::dictionary_iterator<T, Code> first1,
+    stl_iterator::dictionary_iterator<T, Code> last1,
+    InputIt2 first2,
+    std::false_type)
+{
+    return std::equal(first1, last1, first2);
+}
+
+template <class Iterator>
+struct __is_dictionary_iterator : std::false_type {};
+
+template <class T, class Code>
+struct __is_dictionary_iterator<stl_iterator::dictionary_iterator<T, Code>> : std::true_type {};
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::count for dictionary_range, which compares value to each dictionary entry, then
+ * counts the matching codes.
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class Code, class U>
+inline std::ptrdiff_t count(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class Code, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::dictionary_iterator<T, Code>>))
+        ((stl_concept::EqualityComparableWith<T, U>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    const U& value)
+{
+    __detail::__equal_to_value<U> p{value};
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    return static_cast<std::ptrdiff_t>(
+        __detail::__dictionary_scan(first, last, p, __detail::__code_count_scan(), 0, n));
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for dictionary_range, which applies p to each dictionary entry, then
+ * counts the matching codes.
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class Code, class UnaryPredicate>
+inline std::ptrdiff_t count_if(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class Code, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::dictionary_iterator<T, Code>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::dictionary_iterator<T, Code>>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count_if(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    UnaryPredicate p)
+{
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    return static_cast<std::ptrdiff_t>(
+        __detail::__dictionary_scan(first, last, p, __detail::__code_count_scan(), 0, n));
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find for dictionary_range, which compares value to each dictionary entry, then
+ * searches the matching codes.
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class Code, class U>
+inline stl_iterator::dictionary_iterator<T, Code> find(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class Code, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::dictionary_iterator<T, Code>>))
+        ((stl_concept::EqualityComparableWith<T, U>)),
+        // Return
+        (stl_iterator::dictionary_iterator<T, Code>)
+    )
+inline find(
+    stl_iterator::dictionary_iterator<T, Code> first,
+    stl_iterator::dictionary_iterator<T, Code> last,
+    const U& value)
+{
+    __detail::__equal_to_value<U> p{value};
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    return first + static_cast<std::ptrdiff_t>(
+        __detail::__dictionary_scan(first, last, p, __detail::__code_find_scan(), n, 0));
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::equal for dictionary_range. When the second range is also a dictionary_range,
+ * the codes are compared directly if both ranges share their dictionary, and through a translation of the first
+ * dictionary into the second one otherwise.
+ * @see stl_algorithm::equal
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class Code, class InputIt2>
+inline bool equal(
+    stl_iterator::dictionary_iterator<T, Code> first1,
+    stl_iterator::dictionary_iterator<T, Code> last1,
+    InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class T, class Code, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::dictionary_iterator<T, Code>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<T, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (bool)
+    )
+inline equal(
+    stl_iterator::dictionary_iterator<T, Code> first1,
+    stl_iterator::dictionary_iterator<T, Code> last1,
+    InputIt2 first2)
+{
+    return __detail::__dictionary_equal(first1, last1, first2, __detail::__is_dictionary_iterator<InputIt2>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_DICTIONARY_RANGE_HPP__
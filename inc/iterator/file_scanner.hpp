@@ -0,0 +1,779 @@
+/** @file */
+#ifndef __STL_ITERATOR_FILE_SCANNER_HPP__
+#define __STL_ITERATOR_FILE_SCANNER_HPP__
+
+#include "iterator/mapped_file.hpp"
+
+#if __STL_ITERATOR_HAS_MAPPED_FILE
+#define __STL_ITERATOR_HAS_FILE_SCANNER 1
+#else
+#define __STL_ITERATOR_HAS_FILE_SCANNER 0
+#endif
+
+#if __STL_ITERATOR_HAS_FILE_SCANNER
+
+#define __STL_ITERATOR_HAS_IO_URING 0
+#if (defined __linux__) && (defined __has_include)
+#if __has_include(<linux/io_uring.h>)
+#undef __STL_ITERATOR_HAS_IO_URING
+#define __STL_ITERATOR_HAS_IO_URING 1
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/move_constructible.hpp"
+#include "algorithm/detail/unary_function_proxy.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+#if __STL_ITERATOR_HAS_IO_URING
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace stl_iterator {
+
+/**
+ * @brief Way a file_scanner reads the file.
+ */
+enum class scan_backend
+{
+    /** @brief io_uring where the kernel allows it, pread otherwise. */
+    automatic,
+    /** @brief Reads kept in flight by an io_uring instance, Linux only. */
+    io_uring,
+    /** @brief Reads issued with pread by a pool of threads, one per buffer. */
+    pread
+};
+
+/**
+ * @brief Parameters of a file_scanner.
+ */
+struct scan_options
+{
+    /** @brief Size in bytes of a read, rounded up to a multiple of the page size and of the element size. */
+    std::size_t buffer_size = 1 << 20;
+    /** @brief Number of reads in flight. */
+    std::size_t queue_depth = 4;
+    /** @brief Bypasses the page cache with O_DIRECT where the file system supports it. */
+    bool direct = false;
+    /** @brief Way the file is read. */
+    scan_backend backend = scan_backend::automatic;
+};
+
+namespace __detail {
+
+/// @cond DEV
+/** @brief Buffer aligned to the page size, as required by O_DIRECT reads. */
+class __aligned_buffer
+{
+public:
+    __aligned_buffer(std::size_t alignment, std::size_t size)
+        : data_(nullptr)
+    {
+        void* data = nullptr;
+        const int error = ::posix_memalign(&data, alignment, size);
+        if (error != 0) {
+            throw std::system_error(error, std::generic_category(), "posix_memalign");
+        }
+        data_.reset(static_cast<unsigned char*>(data));
+    }
+
+    unsigned char* data() const
+    {
+        return data_.get();
+    }
+
+private:
+    struct __Free
+    {
+        void operator()(unsigned char* p) const
+        {
+            std::free(p);
+        }
+    };
+
+    std::unique_ptr<unsigned char, __Free> data_;
+};
+
+/**
+ * @brief Reads at offset with pread until expected bytes are read or the end of the file, returns the bytes read.
+ *
+ * Each read asks for the rest of the length bytes of the buffer, so that the reads of a whole aligned buffer allowed
+ * by O_DIRECT are not split at the end of the file.
+ */
+inline std::size_t __pread_fully(
+    int fd,
+    unsigned char* buffer,
+    std::size_t length,
+    std::size_t expected,
+    std::size_t offset)
+{
+    std::size_t done = 0;
+    while (done < expected) {
+        const ::ssize_t n = ::pread(fd, buffer + done, length - done, static_cast<::off_t>(offset + done));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            __throw_errno("pread");
+        }
+        if (n == 0) {
+            break;
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    return done;
+}
+
+/**
+ * @brief Reads the chunks of a file in order with a pool of threads, each thread filling one buffer with pread.
+ *
+ * The buffer of chunk c is c % depth, read by the thread of that buffer while the consumer processes the others.
+ */
+class __pread_reader
+{
+public:
+    /**
+     * @param consume - called as consume(buffer, length, offset) for each chunk in file order, stops the scan when
+     * it returns false
+     */
+    template <class Consumer>
+    static void run(
+        int fd,
+        std::size_t file_size,
+        std::vector<__aligned_buffer>& buffers,
+        std::size_t buffer_size,
+        Consumer& consume)
+    {
+        const std::size_t depth = buffers.size();
+        const std::size_t chunks = (file_size + buffer_size - 1) / buffer_size;
+        std::vector<__Slot> slots(depth);
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool stop = false;
+
+        std::vector<std::thread> threads;
+        for (std::size_t w = 0; w < depth && w < chunks; ++w) {
+            threads.emplace_back([&, w]() {
+                for (std::size_t c = w; c < chunks; c += depth) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        changed.wait(lock, [&]() { return stop || !slots[w].ready; });
+                        if (stop) {
+                            return;
+                        }
+                    }
+                    std::size_t length = 0;
+                    int error = 0;
+                    try {
+                        length = __pread_fully(fd, buffers[w].data(), buffer_size,
+                            std::min(buffer_size, file_size - c * buffer_size), c * buffer_size);
+                    } catch (const std::system_error& e) {
+                        error = e.code().value();
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        slots[w].ready = true;
+                        slots[w].length = length;
+                        slots[w].error = error;
+                    }
+                    changed.notify_all();
+                }
+            });
+        }
+
+        auto join = [&]() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            changed.notify_all();
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        };
+
+        int error = 0;
+        try {
+            for (std::size_t c = 0; c < chunks; ++c) {
+                __Slot& slot = slots[c % depth];
+                std::size_t length = 0;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&]() { return slot.ready; });
+                    length = slot.length;
+                    error = slot.error;
+                }
+                if (error != 0 || !consume(buffers[c % depth].data(), length, c * buffer_size)) {
+                    break;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    slot.ready = false;
+                }
+                changed.notify_all();
+            }
+        } catch (...) {
+            join();
+            throw;
+        }
+
+        join();
+        if (error != 0) {
+            throw std::system_error(error, std::generic_category(), "pread");
+        }
+    }
+
+private:
+    struct __Slot
+    {
+        bool ready = false;
+        std::size_t length = 0;
+        int error = 0;
+    };
+};
+
+#if __STL_ITERATOR_HAS_IO_URING
+/**
+ * @brief Minimal io_uring instance submitting vectored reads, built on the raw system calls.
+ */
+class __io_uring
+{
+public:
+    /** @brief Sets up a ring of at least entries entries, throws std::system_error if the kernel refuses. */
+    explicit __io_uring(unsigned entries)
+        : fd_(-1)
+    {
+        ::io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            __throw_errno("io_uring_setup");
+        }
+        try {
+            map(params);
+        } catch (...) {
+            ::close(fd_);
+            throw;
+        }
+    }
+
+    __io_uring(const __io_uring&) = delete;
+    __io_uring& operator=(const __io_uring&) = delete;
+
+    ~__io_uring()
+    {
+        ::close(fd_);
+    }
+
+    /** @brief Queues and submits a read of iov at offset of fd. */
+    void submit_read(int fd, const ::iovec* iov, std::size_t offset, std::uint64_t user_data)
+    {
+        const unsigned tail = *sq_tail_;
+        const unsigned index = tail & *sq_mask_;
+        ::io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<std::uint64_t>(iov);
+        sqe->len = 1;
+        sqe->off = offset;
+        sqe->user_data = user_data;
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        enter(1, 0, 0);
+    }
+
+    /** @brief Waits for a completion, returns its user data and stores its result in res. */
+    std::uint64_t wait(int& res)
+    {
+        for (;;) {
+            const unsigned head = *cq_head_;
+            if (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+                const ::io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+                const std::uint64_t user_data = cqe.user_data;
+                res = cqe.res;
+                __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+                return user_data;
+            }
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+        }
+    }
+
+private:
+    void enter(unsigned to_submit, unsigned min_complete, unsigned flags)
+    {
+        while (::syscall(__NR_io_uring_enter, fd_, to_submit, min_complete, flags, nullptr, 0) < 0) {
+            if (errno != EINTR) {
+                __throw_errno("io_uring_enter");
+            }
+        }
+    }
+
+    void map(const ::io_uring_params& params)
+    {
+        std::size_t sq_length = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        std::size_t cq_length = params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+        bool single = false;
+#if (defined IORING_FEAT_SINGLE_MMAP)
+        single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) {
+            sq_length = cq_length = std::max(sq_length, cq_length);
+        }
+#endif
+        sq_ring_ = __ring_mapping(fd_, IORING_OFF_SQ_RING, sq_length);
+        if (!single) {
+            cq_ring_ = __ring_mapping(fd_, IORING_OFF_CQ_RING, cq_length);
+        }
+        sqe_ring_ = __ring_mapping(fd_, IORING_OFF_SQES, params.sq_entries * sizeof(::io_uring_sqe));
+
+        unsigned char* sq = sq_ring_.data();
+        unsigned char* cq = single ? sq : cq_ring_.data();
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sqes_ = reinterpret_cast<::io_uring_sqe*>(sqe_ring_.data());
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<::io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    /** @brief Shared mapping of a ring, unmapped on destruction. */
+    class __ring_mapping
+    {
+    public:
+        __ring_mapping()
+            : data_(nullptr)
+            , length_(0)
+        {}
+
+        __ring_mapping(int fd, std::uint64_t offset, std::size_t length)
+            : __ring_mapping()
+        {
+            void* data = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                static_cast<::off_t>(offset));
+            if (data == MAP_FAILED) {
+                __throw_errno("mmap");
+            }
+            data_ = static_cast<unsigned char*>(data);
+            length_ = length;
+        }
+
+        __ring_mapping(const __ring_mapping&) = delete;
+
+        __ring_mapping& operator=(__ring_mapping&& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(length_, other.length_);
+            return *this;
+        }
+
+        ~__ring_mapping()
+        {
+            if (data_ != nullptr) {
+                ::munmap(data_, length_);
+            }
+        }
+
+        unsigned char* data() const
+        {
+            return data_;
+        }
+
+    private:
+        unsigned char* data_;
+        std::size_t length_;
+    };
+
+    int fd_;
+    __ring_mapping sq_ring_;
+    __ring_mapping cq_ring_;
+    __ring_mapping sqe_ring_;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    ::io_uring_sqe* sqes_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    ::io_uring_cqe* cqes_ = nullptr;
+};
+
+/**
+ * @brief Reads the chunks of a file in order, keeping a read in flight in the io_uring instance for each buffer.
+ */
+class __io_uring_reader
+{
+public:
+    /** @brief Same as __pread_reader::run, with the reads submitted to ring. */
+    template <class Consumer>
+    static void run(
+        __io_uring& ring,
+        int fd,
+        std::size_t file_size,
+        std::vector<__aligned_buffer>& buffers,
+        std::size_t buffer_size,
+        Consumer& consume)
+    {
+        const std::size_t depth = buffers.size();
+        const std::size_t chunks = (file_size + buffer_size - 1) / buffer_size;
+        std::vector<::iovec> iovs(depth);
+        std::vector<int> results(depth);
+        std::vector<bool> done(depth);
+        std::size_t in_flight = 0;
+
+        auto submit = [&](std::size_t c) {
+            const std::size_t b = c % depth;
+            iovs[b].iov_base = buffers[b].data();
+            iovs[b].iov_len = buffer_size;
+            done[b] = false;
+            ring.submit_read(fd, &iovs[b], c * buffer_size, c);
+            ++in_flight;
+        };
+        for (std::size_t c = 0; c < depth && c < chunks; ++c) {
+            submit(c);
+        }
+
+        std::size_t c = 0;
+        try {
+            for (; c < chunks; ++c) {
+                const std::size_t b = c % depth;
+                while (!done[b]) {
+                    int res = 0;
+                    const std::size_t completed = static_cast<std::size_t>(ring.wait(res));
+                    --in_flight;
+                    results[completed % depth] = res;
+                    done[completed % depth] = true;
+                }
+                if (results[b] < 0) {
+                    throw std::system_error(-results[b], std::generic_category(), "io_uring read");
+                }
+                // A short read before the end of the file is completed synchronously.
+                std::size_t length = static_cast<std::size_t>(results[b]);
+                const std::size_t expected = std::min(buffer_size, file_size - c * buffer_size);
+                if (length < expected && length > 0) {
+                    length += __pread_fully(fd, buffers[b].data() + length, buffer_size - length,
+                        expected - length, c * buffer_size + length);
+                }
+                if (!consume(buffers[b].data(), length, c * buffer_size)) {
+                    break;
+                }
+                if (c + depth < chunks) {
+                    submit(c + depth);
+                }
+            }
+        } catch (...) {
+            drain(ring, in_flight);
+            throw;
+        }
+        drain(ring, in_flight);
+    }
+
+private:
+    /** @brief Waits for the reads still in flight, which write into the buffers. */
+    static void drain(__io_uring& ring, std::size_t in_flight)
+    {
+        for (; in_flight > 0; --in_flight) {
+            int res = 0;
+            ring.wait(res);
+        }
+    }
+};
+#endif // __STL_ITERATOR_HAS_IO_URING
+/// @endcond
+
+} // namespace __detail
+
+/**
+ * @brief Streams a file through a few large buffers which are read ahead while the algorithms run on the others.
+ *
+ * <p>
+ * Scanning a cold file through a mapping stalls on each page fault. A file_scanner keeps several large reads in
+ * flight, through io_uring on Linux or a pool of threads issuing pread otherwise, and hands each completed buffer to
+ * the algorithm in file order. The overloads of stl_algorithm::find, count_if, any_of and for_each taking a
+ * file_scanner carry their state from a buffer to the next one.<br/>
+ * The file is viewed as an array of T, trailing bytes which do not form a whole element are not part of the range.
+ * Errors of the system calls throw std::system_error.
+ * </p>
+ * @tparam T - element type, must be trivially copyable
+ */
+template <class T = char>
+class file_scanner
+{
+    static_assert(std::is_trivially_copyable<T>::value, "file_scanner requires trivially copyable elements");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @param path - path of the file to scan
+     * @param options - sizes of the reads and backend
+     */
+    explicit file_scanner(const std::string& path, const scan_options& options = scan_options())
+        : file_(open(path, options.direct))
+        , size_(file_.size() / sizeof(T))
+        , buffer_size_(round_buffer_size(options.buffer_size))
+        , depth_(options.queue_depth == 0 ? 1 : options.queue_depth)
+        , backend_(select_backend(options.backend))
+    {}
+
+    /** @brief Returns the number of elements in the file. */
+    size_type size() const
+    {
+        return size_;
+    }
+
+    /** @brief Returns the backend actually used, automatic is resolved when the scanner is constructed. */
+    scan_backend backend() const
+    {
+        return backend_;
+    }
+
+    /**
+     * @brief Calls f(first, last, offset) for each buffer in file order, until f returns false.
+     *
+     * [first, last) are the elements of the buffer and offset is the index in the file of *first.
+     * @return true if every buffer was processed
+     */
+    template <class BufferFunction>
+    bool scan(BufferFunction f) const
+    {
+        if (size_ == 0) {
+            return true;
+        }
+        bool complete = true;
+        auto consume = [&](unsigned char* data, std::size_t length, std::size_t offset) -> bool {
+            const T* first = reinterpret_cast<const T*>(data);
+            const std::size_t count = std::min(length, size_ * sizeof(T) - offset) / sizeof(T);
+            if (count == 0) {
+                return true;
+            }
+            complete = f(first, first + count, offset / sizeof(T));
+            return complete;
+        };
+
+        std::vector<__detail::__aligned_buffer> buffers;
+        const std::size_t chunks = (size_ * sizeof(T) + buffer_size_ - 1) / buffer_size_;
+        for (std::size_t i = 0; i < depth_ && i < chunks; ++i) {
+            buffers.emplace_back(page_size(), buffer_size_);
+        }
+#if __STL_ITERATOR_HAS_IO_URING
+        if (backend_ == scan_backend::io_uring) {
+            __detail::__io_uring ring(static_cast<unsigned>(buffers.size()));
+            __detail::__io_uring_reader::run(ring, file_.get(), size_ * sizeof(T), buffers, buffer_size_, consume);
+            return complete;
+        }
+#endif
+        __detail::__pread_reader::run(file_.get(), size_ * sizeof(T), buffers, buffer_size_, consume);
+        return complete;
+    }
+
+private:
+    static std::size_t page_size()
+    {
+        return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    }
+
+    static std::size_t round_buffer_size(std::size_t size)
+    {
+        // A multiple of the page size for O_DIRECT, and of the element size so that no element spans two buffers.
+        const std::size_t unit = page_size() * sizeof(T);
+        return size <= unit ? unit : (size + unit - 1) / unit * unit;
+    }
+
+    static __detail::__readonly_file open(const std::string& path, bool direct)
+    {
+#if (defined O_DIRECT)
+        if (direct) {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+            if (fd >= 0) {
+                return __detail::__readonly_file(fd);
+            }
+        }
+#else
+        static_cast<void>(direct);
+#endif
+        return __detail::__readonly_file(path);
+    }
+
+    static scan_backend select_backend(scan_backend backend)
+    {
+#if __STL_ITERATOR_HAS_IO_URING
+        if (backend == scan_backend::automatic) {
+            try {
+                __detail::__io_uring probe(1);
+                return scan_backend::io_uring;
+            } catch (const std::system_error&) {
+                return scan_backend::pread;
+            }
+        }
+        if (backend == scan_backend::io_uring) {
+            __detail::__io_uring probe(1);
+        }
+        return backend;
+#else
+        if (backend == scan_backend::io_uring) {
+            throw std::system_error(std::make_error_code(std::errc::function_not_supported), "io_uring");
+        }
+        return scan_backend::pread;
+#endif
+    }
+
+    __detail::__readonly_file file_;
+    size_type size_;
+    std::size_t buffer_size_;
+    std::size_t depth_;
+    scan_backend backend_;
+};
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/**
+ * @brief Overload of stl_algorithm::find for the elements of a file streamed by a file_scanner.
+ *
+ * <p>
+ * Each buffer is searched as a contiguous array, the scan stops at the buffer holding the element.
+ * </p>
+ * @return index of the first element equal to value in the file, or scanner.size() if there is no such element
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class U>
+inline std::size_t find(const stl_iterator::file_scanner<T>& scanner, const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::EqualityComparableWith<T, U>)),
+        // Return
+        (std::size_t)
+    )
+inline find(const stl_iterator::file_scanner<T>& scanner, const U& value)
+{
+    std::size_t found = scanner.size();
+    scanner.scan([&](const T* first, const T* last, std::size_t offset) {
+        const T* it = std::find(first, last, value);
+        if (it == last) {
+            return true;
+        }
+        found = offset + static_cast<std::size_t>(it - first);
+        return false;
+    });
+    return found;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for the elements of a file streamed by a file_scanner.
+ *
+ * <p>
+ * Each buffer is counted as a contiguous array.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline std::ptrdiff_t count_if(const stl_iterator::file_scanner<T>& scanner, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, const T*>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count_if(const stl_iterator::file_scanner<T>& scanner, UnaryPredicate p)
+{
+    std::ptrdiff_t n = 0;
+    scanner.scan([&](const T* first, const T* last, std::size_t) {
+        n += std::count_if(first, last, std::ref(p));
+        return true;
+    });
+    return n;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for the elements of a file streamed by a file_scanner.
+ *
+ * <p>
+ * The scan stops at the buffer holding the first element for which p returns true.
+ * </p>
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline bool any_of(const stl_iterator::file_scanner<T>& scanner, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, const T*>)),
+        // Return
+        (bool)
+    )
+inline any_of(const stl_iterator::file_scanner<T>& scanner, UnaryPredicate p)
+{
+    return !scanner.scan([&](const T* first, const T* last, std::size_t) {
+        return std::none_of(first, last, std::ref(p));
+    });
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::for_each for the elements of a file streamed by a file_scanner.
+ *
+ * <p>
+ * f is applied to the elements in file order, the same function object is carried from a buffer to the next one.
+ * </p>
+ * @see stl_algorithm::for_each
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryFunction>
+inline UnaryFunction for_each(const stl_iterator::file_scanner<T>& scanner, UnaryFunction f);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryFunction>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::MoveConstructible<UnaryFunction>))
+        ((__detail::__UnaryFunctionProxy<UnaryFunction, const T*>)),
+        // Return
+        (UnaryFunction)
+    )
+inline for_each(const stl_iterator::file_scanner<T>& scanner, UnaryFunction f)
+{
+    scanner.scan([&](const T* first, const T* last, std::size_t) {
+        std::for_each(first, last, std::ref(f));
+        return true;
+    });
+    return f;
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif // __STL_ITERATOR_HAS_FILE_SCANNER
+
+#endif  // __STL_ITERATOR_FILE_SCANNER_HPP__
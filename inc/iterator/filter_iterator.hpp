@@ -0,0 +1,386 @@
+/** @file */
+#ifndef __STL_ITERATOR_FILTER_ITERATOR_HPP__
+#define __STL_ITERATOR_FILTER_ITERATOR_HPP__
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <boost/concept/requires.hpp>
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+#include "iterator/iterator_range.hpp"
+#include "iterator/detail/function_box.hpp"
+#include "iterator/detail/fusion.hpp"
+#include "iterator/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief Iterator adapter which lazily skips the elements of the adapted range for which a predicate returns false.
+ *
+ * <p>
+ * No element is copied, so a filter stage in a pipeline does not materialize an intermediate container.<br/>
+ * The iterator category is the category of Iterator, up to forward iterator.
+ * </p>
+ * @tparam Predicate - must meet the requirements of <i>stl_concept::UnaryPredicate</i>.
+ * @tparam Iterator - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ */
+template <class Predicate, class Iterator>
+class filter_iterator
+{
+public:
+    using iterator_category = typename std::common_type<
+        std::forward_iterator_tag,
+        __detail::__iterator_category_t<Iterator>>::type;
+    using value_type = __detail::__iterator_value_t<Iterator>;
+    using reference = __detail::__iterator_reference_t<Iterator>;
+    using pointer = __detail::__iterator_pointer_t<Iterator>;
+    using difference_type = __detail::__iterator_difference_t<Iterator>;
+
+    filter_iterator() = default;
+
+    /**
+     * @param p - predicate which returns true for the elements to be visited
+     * @param first - position in the adapted range, moved forward to the first element satisfying p
+     * @param last - end of the adapted range
+     */
+    filter_iterator(Predicate p, Iterator first, Iterator last)
+        : pred_(p)
+        , iter_(first)
+        , last_(last)
+    {
+        satisfy();
+    }
+
+    /** @brief Returns the current position in the adapted range. */
+    const Iterator& base() const
+    {
+        return iter_;
+    }
+
+    /** @brief Returns the end of the adapted range. */
+    const Iterator& end() const
+    {
+        return last_;
+    }
+
+    /** @brief Returns the predicate. */
+    const Predicate& predicate() const
+    {
+        return pred_.get();
+    }
+
+    reference operator*() const
+    {
+        return *iter_;
+    }
+
+    filter_iterator& operator++()
+    {
+        ++iter_;
+        satisfy();
+        return *this;
+    }
+
+    filter_iterator operator++(int)
+    {
+        filter_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const filter_iterator& lhs, const filter_iterator& rhs)
+    {
+        return lhs.iter_ == rhs.iter_;
+    }
+
+    friend bool operator!=(const filter_iterator& lhs, const filter_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    void satisfy()
+    {
+        while (iter_ != last_ && !pred_.get()(*iter_)) {
+            ++iter_;
+        }
+    }
+
+    __detail::__function_box<Predicate> pred_;
+    Iterator iter_;
+    Iterator last_;
+};
+
+/**
+ * @brief Creates a filter_iterator positioned at the first element of [first, last) satisfying p.
+ */
+template <class Predicate, class Iterator>
+inline filter_iterator<Predicate, Iterator> make_filter_iterator(Predicate p, Iterator first, Iterator last)
+{
+    return filter_iterator<Predicate, Iterator>(p, first, last);
+}
+
+/**
+ * @brief Lazy view of the elements of range for which p returns true.
+ * @param range - range to be adapted, it must outlive the returned view
+ * @param p - predicate which returns true for the elements to be visited
+ * @return iterator_range of filter_iterator
+ */
+template <class Range, class Predicate>
+inline iterator_range<filter_iterator<Predicate, __detail::__range_iterator_t<Range>>>
+filtered(Range& range, Predicate p)
+{
+    using __Iterator = filter_iterator<Predicate, __detail::__range_iterator_t<Range>>;
+    return iterator_range<__Iterator>(
+        __Iterator(p, std::begin(range), std::end(range)),
+        __Iterator(p, std::end(range), std::end(range)));
+}
+
+/** @overload */
+template <class Range, class Predicate>
+inline iterator_range<filter_iterator<Predicate, __detail::__range_iterator_t<const Range>>>
+filtered(const Range& range, Predicate p)
+{
+    using __Iterator = filter_iterator<Predicate, __detail::__range_iterator_t<const Range>>;
+    return iterator_range<__Iterator>(
+        __Iterator(p, std::begin(range), std::end(range)),
+        __Iterator(p, std::end(range), std::end(range)));
+}
+
+namespace __detail {
+
+/// @cond DEV
+template <class Predicate, class Iterator>
+struct __fusion<filter_iterator<Predicate, Iterator>>
+{
+    using __Inner = __fusion<Iterator>;
+    using base_iterator = typename __Inner::base_iterator;
+
+    static base_iterator base(const filter_iterator<Predicate, Iterator>& it)
+    {
+        return __Inner::base(it.base());
+    }
+
+    template <class P>
+    static auto predicate(const filter_iterator<Predicate, Iterator>& it, P p)
+        -> decltype(__Inner::predicate(it.base(), __and_predicate<Predicate, P>{it.predicate(), std::move(p)}))
+    {
+        return __Inner::predicate(it.base(), __and_predicate<Predicate, P>{it.predicate(), std::move(p)});
+    }
+
+    static filter_iterator<Predicate, Iterator> rebind(const filter_iterator<Predicate, Iterator>& it, base_iterator b)
+    {
+        return filter_iterator<Predicate, Iterator>(it.predicate(), __Inner::rebind(it.base(), b), it.end());
+    }
+};
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/**
+ * @brief Overload of stl_algorithm::find_if for filter_iterator ranges.
+ *
+ * <p>
+ * Returns the first element of the view for which p returns true.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+inline stl_iterator::filter_iterator<Predicate, Iterator> find_if(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::filter_iterator<Predicate, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::filter_iterator<Predicate, Iterator>>)),
+        // Return
+        (stl_iterator::filter_iterator<Predicate, Iterator>)
+    )
+inline find_if(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if_not for filter_iterator ranges.
+ *
+ * <p>
+ * Returns the first element of the view for which p returns false.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::find_if_not
+ */
+#ifdef DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+inline stl_iterator::filter_iterator<Predicate, Iterator> find_if_not(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::filter_iterator<Predicate, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::filter_iterator<Predicate, Iterator>>)),
+        // Return
+        (stl_iterator::filter_iterator<Predicate, Iterator>)
+    )
+inline find_if_not(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if_not(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for filter_iterator ranges.
+ *
+ * <p>
+ * Returns the number of elements of the view for which p returns true.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+inline auto count_if(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+    -> decltype(typename std::iterator_traits<stl_iterator::filter_iterator<Predicate, Iterator>>::difference_type);
+#else // DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::filter_iterator<Predicate, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::filter_iterator<Predicate, Iterator>>)),
+        // Return
+        (__detail::__iterator_difference_t<stl_iterator::filter_iterator<Predicate, Iterator>>)
+    )
+inline count_if(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_count_if(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::all_of for filter_iterator ranges.
+ *
+ * <p>
+ * Checks if p returns true for all elements of the view.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::all_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+inline bool all_of(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::filter_iterator<Predicate, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::filter_iterator<Predicate, Iterator>>)),
+        // Return
+        (bool)
+    )
+inline all_of(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if_not(first, last, p) == last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for filter_iterator ranges.
+ *
+ * <p>
+ * Checks if p returns true for at least one element of the view.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+inline bool any_of(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::filter_iterator<Predicate, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::filter_iterator<Predicate, Iterator>>)),
+        // Return
+        (bool)
+    )
+inline any_of(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if(first, last, p) != last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::none_of for filter_iterator ranges.
+ *
+ * <p>
+ * Checks if p returns true for no elements of the view.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::none_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+inline bool none_of(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Predicate, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::filter_iterator<Predicate, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::filter_iterator<Predicate, Iterator>>)),
+        // Return
+        (bool)
+    )
+inline none_of(
+    stl_iterator::filter_iterator<Predicate, Iterator> first,
+    stl_iterator::filter_iterator<Predicate, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if(first, last, p) == last;
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_FILTER_ITERATOR_HPP__
@@ -0,0 +1,378 @@
+/** @file */
+#ifndef __STL_ITERATOR_GATHER_ITERATOR_HPP__
+#define __STL_ITERATOR_GATHER_ITERATOR_HPP__
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/lane_kernel.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+#include "iterator/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief Iterator over the elements of an array selected by a sequence of indices.
+ *
+ * <p>
+ * Dereferencing yields base[*index], so that a subset of an array, given as a list of positions, is visited without
+ * copying the selected elements into a temporary container.<br/>
+ * The iterator category is the category of IndexIterator, up to random access.
+ * </p>
+ * @tparam T - element type, may be const qualified
+ * @tparam IndexIterator - must meet the requirements of <i>stl_concept::InputIterator</i>, the value type must be
+ * integral.
+ */
+template <class T, class IndexIterator>
+class gather_iterator
+{
+    static_assert(std::is_integral<__detail::__iterator_value_t<IndexIterator>>::value,
+        "gather_iterator requires integral indices");
+
+public:
+    using iterator_category = typename std::common_type<
+        std::random_access_iterator_tag,
+        __detail::__iterator_category_t<IndexIterator>>::type;
+    using value_type = typename std::remove_cv<T>::type;
+    using reference = T&;
+    using pointer = T*;
+    using difference_type = __detail::__iterator_difference_t<IndexIterator>;
+
+    gather_iterator()
+        : base_(nullptr)
+        , index_()
+    {}
+
+    /**
+     * @param base - pointer to the first element of the array
+     * @param index - iterator to the index of the current element
+     */
+    gather_iterator(T* base, IndexIterator index)
+        : base_(base)
+        , index_(index)
+    {}
+
+    /** @brief Returns the pointer to the first element of the array. */
+    pointer base() const
+    {
+        return base_;
+    }
+
+    /** @brief Returns the iterator to the index of the current element. */
+    const IndexIterator& index() const
+    {
+        return index_;
+    }
+
+    reference operator*() const
+    {
+        return base_[*index_];
+    }
+
+    pointer operator->() const
+    {
+        return &base_[*index_];
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return base_[index_[n]];
+    }
+
+    gather_iterator& operator++()
+    {
+        ++index_;
+        return *this;
+    }
+
+    gather_iterator operator++(int)
+    {
+        gather_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    gather_iterator& operator--()
+    {
+        --index_;
+        return *this;
+    }
+
+    gather_iterator operator--(int)
+    {
+        gather_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    gather_iterator& operator+=(difference_type n)
+    {
+        index_ += n;
+        return *this;
+    }
+
+    gather_iterator& operator-=(difference_type n)
+    {
+        index_ -= n;
+        return *this;
+    }
+
+    friend gather_iterator operator+(gather_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend gather_iterator operator+(difference_type n, gather_iterator it)
+    {
+        return it += n;
+    }
+
+    friend gather_iterator operator-(gather_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return lhs.index_ - rhs.index_;
+    }
+
+    friend bool operator==(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return lhs.index_ == rhs.index_;
+    }
+
+    friend bool operator!=(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return lhs.index_ < rhs.index_;
+    }
+
+    friend bool operator>(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const gather_iterator& lhs, const gather_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    pointer base_;
+    IndexIterator index_;
+};
+
+/**
+ * @brief Creates a gather_iterator visiting base[*index].
+ * @param base - pointer to the first element of the array
+ * @param index - iterator to the first index
+ */
+template <class T, class IndexIterator>
+inline gather_iterator<T, IndexIterator> make_gather_iterator(T* base, IndexIterator index)
+{
+    return gather_iterator<T, IndexIterator>(base, index);
+}
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+template <class T, class IndexIterator, class Predicate>
+inline stl_iterator::gather_iterator<T, IndexIterator> __gather_find_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    Predicate& p,
+    std::true_type)
+{
+    return first + __lane_find_if(first, last - first, p);
+}
+
+template <class T, class IndexIterator, class Predicate>
+inline stl_iterator::gather_iterator<T, IndexIterator> __gather_find_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    Predicate& p,
+    std::false_type)
+{
+    return std::find_if(first, last, std::ref(p));
+}
+
+template <class T, class IndexIterator, class Predicate>
+inline __iterator_difference_t<IndexIterator> __gather_count_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    Predicate& p,
+    std::true_type)
+{
+    return __lane_count_if(first, last - first, p);
+}
+
+template <class T, class IndexIterator, class Predicate>
+inline __iterator_difference_t<IndexIterator> __gather_count_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    Predicate& p,
+    std::false_type)
+{
+    return std::count_if(first, last, std::ref(p));
+}
+
+template <class T, class IndexIterator>
+using __gather_kernel_tag = __is_lane_gatherable<stl_iterator::gather_iterator<T, IndexIterator>>;
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::find for gather_iterator ranges.
+ *
+ * <p>
+ * With random access indices, elements are gathered a block of lanes at a time and compared without branches.
+ * </p>
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class IndexIterator, class U>
+inline stl_iterator::gather_iterator<T, IndexIterator> find(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class IndexIterator, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::gather_iterator<T, IndexIterator>>))
+        ((stl_concept::EqualityComparableWith<typename std::remove_cv<T>::type, U>)),
+        // Return
+        (stl_iterator::gather_iterator<T, IndexIterator>)
+    )
+inline find(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    const U& value)
+{
+    __detail::__equal_to_value<U> p{value};
+    return __detail::__gather_find_if(first, last, p, __detail::__gather_kernel_tag<T, IndexIterator>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if for gather_iterator ranges.
+ *
+ * <p>
+ * With random access indices, elements are gathered a block of lanes at a time and tested without branches.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class IndexIterator, class UnaryPredicate>
+inline stl_iterator::gather_iterator<T, IndexIterator> find_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class IndexIterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::gather_iterator<T, IndexIterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::gather_iterator<T, IndexIterator>>)),
+        // Return
+        (stl_iterator::gather_iterator<T, IndexIterator>)
+    )
+inline find_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    UnaryPredicate p)
+{
+    return __detail::__gather_find_if(first, last, p, __detail::__gather_kernel_tag<T, IndexIterator>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count for gather_iterator ranges.
+ *
+ * <p>
+ * With random access indices, elements are gathered a block of lanes at a time and compared without branches.
+ * </p>
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class IndexIterator, class U>
+inline auto count(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    const U& value)
+    -> decltype(typename std::iterator_traits<IndexIterator>::difference_type);
+#else // DOXYGEN_WORKING
+template <class T, class IndexIterator, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::gather_iterator<T, IndexIterator>>))
+        ((stl_concept::EqualityComparableWith<typename std::remove_cv<T>::type, U>)),
+        // Return
+        (__detail::__iterator_difference_t<IndexIterator>)
+    )
+inline count(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    const U& value)
+{
+    __detail::__equal_to_value<U> p{value};
+    return __detail::__gather_count_if(first, last, p, __detail::__gather_kernel_tag<T, IndexIterator>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for gather_iterator ranges.
+ *
+ * <p>
+ * With random access indices, elements are gathered a block of lanes at a time and tested without branches.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class IndexIterator, class UnaryPredicate>
+inline auto count_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    UnaryPredicate p)
+    -> decltype(typename std::iterator_traits<IndexIterator>::difference_type);
+#else // DOXYGEN_WORKING
+template <class T, class IndexIterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::gather_iterator<T, IndexIterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::gather_iterator<T, IndexIterator>>)),
+        // Return
+        (__detail::__iterator_difference_t<IndexIterator>)
+    )
+inline count_if(
+    stl_iterator::gather_iterator<T, IndexIterator> first,
+    stl_iterator::gather_iterator<T, IndexIterator> last,
+    UnaryPredicate p)
+{
+    return __detail::__gather_count_if(first, last, p, __detail::__gather_kernel_tag<T, IndexIterator>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_GATHER_ITERATOR_HPP__
@@ -0,0 +1,442 @@
+/** @file */
+#ifndef __STL_ITERATOR_GENERATOR_HPP__
+#define __STL_ITERATOR_GENERATOR_HPP__
+
+// The generator requires C++20 coroutines, it is only available in builds configured with STL_CONCEPTS_CXX20.
+#if (defined __cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#define __STL_ITERATOR_HAS_GENERATOR 1
+#else
+#define __STL_ITERATOR_HAS_GENERATOR 0
+#endif
+
+#if __STL_ITERATOR_HAS_GENERATOR
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace stl_iterator {
+
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Allocation of coroutine frames.
+ *
+ * <p>
+ * A frame is followed by the function which deallocates it and a copy of the allocator which allocated it, so that
+ * the frame can be deallocated knowing only its size.
+ * </p>
+ */
+struct __frame_allocation
+{
+    using __Deallocate = void (*)(void* frame, std::size_t size);
+
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) __Block
+    {
+        unsigned char bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    static constexpr std::size_t __align(std::size_t size, std::size_t alignment)
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    static __Deallocate* deallocator(void* frame, std::size_t size)
+    {
+        return reinterpret_cast<__Deallocate*>(
+            static_cast<unsigned char*>(frame) + __align(size, alignof(__Deallocate)));
+    }
+
+    template <class Allocator>
+    static Allocator* allocator(void* frame, std::size_t size)
+    {
+        return reinterpret_cast<Allocator*>(
+            static_cast<unsigned char*>(frame) +
+            __align(__align(size, alignof(__Deallocate)) + sizeof(__Deallocate), alignof(Allocator)));
+    }
+
+    template <class Allocator>
+    static std::size_t blocks(std::size_t size)
+    {
+        const std::size_t total = __align(__align(size, alignof(__Deallocate)) + sizeof(__Deallocate),
+            alignof(Allocator)) + sizeof(Allocator);
+        return (total + sizeof(__Block) - 1) / sizeof(__Block);
+    }
+
+    static void* allocate(std::size_t size)
+    {
+        void* frame = ::operator new(__align(size, alignof(__Deallocate)) + sizeof(__Deallocate));
+        *deallocator(frame, size) = [](void* p, std::size_t n) {
+            ::operator delete(p, __align(n, alignof(__Deallocate)) + sizeof(__Deallocate));
+        };
+        return frame;
+    }
+
+    template <class Allocator>
+    static void* allocate(std::size_t size, const Allocator& alloc)
+    {
+        using __BlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<__Block>;
+        using __Traits = std::allocator_traits<__BlockAllocator>;
+
+        __BlockAllocator block_alloc(alloc);
+        void* frame = std::addressof(*__Traits::allocate(block_alloc, blocks<__BlockAllocator>(size)));
+        ::new (static_cast<void*>(allocator<__BlockAllocator>(frame, size))) __BlockAllocator(std::move(block_alloc));
+        *deallocator(frame, size) = [](void* p, std::size_t n) {
+            __BlockAllocator* stored = allocator<__BlockAllocator>(p, n);
+            __BlockAllocator moved(std::move(*stored));
+            stored->~__BlockAllocator();
+            __Traits::deallocate(moved, static_cast<__Block*>(p), blocks<__BlockAllocator>(n));
+        };
+        return frame;
+    }
+
+    static void deallocate(void* frame, std::size_t size)
+    {
+        (*deallocator(frame, size))(frame, size);
+    }
+};
+/// @endcond
+
+} // namespace __detail
+
+/**
+ * @brief Coroutine type producing a sequence of values on demand.
+ *
+ * <p>
+ * A coroutine returning generator<T> produces values with co_yield. Its iterator satisfies
+ * <i>stl_concept::InputIterator</i>, so the values stream into the algorithms without being buffered in a
+ * container.<br/>
+ * The coroutine frame is allocated with the global operator new by default. When the first two parameters of the
+ * coroutine are std::allocator_arg_t and an allocator, the frame is allocated with a copy of that allocator
+ * instead, so that a generator built on a user-supplied arena does not touch the heap.
+ * </p>
+ * ```
+ * stl_iterator::generator<int> iota(std::allocator_arg_t, Arena alloc, int n)
+ * {
+ *     for (int i = 0; i < n; ++i) {
+ *         co_yield i;
+ *     }
+ * }
+ * ```
+ * @tparam T - value type
+ */
+template <class T>
+class generator
+{
+public:
+    class promise_type
+    {
+    public:
+        generator get_return_object() noexcept
+        {
+            return return_object(*this);
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(const T& value) noexcept
+        {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        // The temporary of co_yield lives until the coroutine resumes, so its address can be kept.
+        std::suspend_always yield_value(T&& value) noexcept
+        {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            exception_ = std::current_exception();
+        }
+
+        template <class U>
+        std::suspend_never await_transform(U&&) = delete;
+
+        const T& value() const noexcept
+        {
+            return *value_;
+        }
+
+        void rethrow_if_exception()
+        {
+            if (exception_) {
+                std::rethrow_exception(std::move(exception_));
+            }
+        }
+
+        static void* operator new(std::size_t size)
+        {
+            return __detail::__frame_allocation::allocate(size);
+        }
+
+        static void operator delete(void* frame, std::size_t size) noexcept
+        {
+            __detail::__frame_allocation::deallocate(frame, size);
+        }
+
+    protected:
+        /**
+         * @brief Returns the generator of the coroutine whose promise is promise.
+         *
+         * The handle of the coroutine is made from the actual type of its promise, Promise, which derives from
+         * promise_type when the frame is allocated with an allocator.
+         */
+        template <class Promise>
+        static generator return_object(Promise& promise) noexcept
+        {
+            return generator(std::coroutine_handle<Promise>::from_promise(promise), &promise);
+        }
+
+    private:
+        const T* value_ = nullptr;
+        std::exception_ptr exception_;
+    };
+
+    /**
+     * @brief Input iterator over the values produced by the coroutine.
+     *
+     * All iterators of a generator share the coroutine, incrementing one of them resumes it.
+     */
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename std::remove_cv<T>::type;
+        using reference = const T&;
+        using pointer = const T*;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept
+        {
+            return promise_->value();
+        }
+
+        pointer operator->() const noexcept
+        {
+            return std::addressof(promise_->value());
+        }
+
+        iterator& operator++()
+        {
+            handle_.resume();
+            if (handle_.done()) {
+                promise_->rethrow_if_exception();
+            }
+            return *this;
+        }
+
+        /** @brief Keeps a copy of the current value, so that *it++ is the value before the increment. */
+        class postfix_proxy
+        {
+        public:
+            explicit postfix_proxy(const value_type& value)
+                : value_(value)
+            {}
+
+            const value_type& operator*() const noexcept
+            {
+                return value_;
+            }
+
+        private:
+            value_type value_;
+        };
+
+        postfix_proxy operator++(int)
+        {
+            postfix_proxy tmp(**this);
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.done() == rhs.done();
+        }
+
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class generator;
+
+        iterator(std::coroutine_handle<> handle, promise_type* promise) noexcept
+            : handle_(handle)
+            , promise_(promise)
+        {}
+
+        bool done() const noexcept
+        {
+            return !handle_ || handle_.done();
+        }
+
+        std::coroutine_handle<> handle_;
+        promise_type* promise_ = nullptr;
+    };
+
+    generator() noexcept = default;
+
+    generator(generator&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr))
+        , promise_(std::exchange(other.promise_, nullptr))
+    {}
+
+    generator& operator=(generator&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, nullptr);
+            promise_ = std::exchange(other.promise_, nullptr);
+        }
+        return *this;
+    }
+
+    generator(const generator&) = delete;
+    generator& operator=(const generator&) = delete;
+
+    ~generator()
+    {
+        reset();
+    }
+
+    /**
+     * @brief Starts the coroutine and returns the iterator to the first value.
+     *
+     * It must be called at most once.
+     */
+    iterator begin()
+    {
+        if (handle_) {
+            ++iterator(handle_, promise_);
+        }
+        return iterator(handle_, promise_);
+    }
+
+    /** @brief Returns the iterator past the last value. */
+    iterator end() noexcept
+    {
+        return iterator();
+    }
+
+private:
+    generator(std::coroutine_handle<> handle, promise_type* promise) noexcept
+        : handle_(handle)
+        , promise_(promise)
+    {}
+
+    void reset() noexcept
+    {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+            promise_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<> handle_;
+    promise_type* promise_ = nullptr;
+};
+
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Promise of a generator whose parameters are std::allocator_arg_t, an allocator and Args.
+ *
+ * <p>
+ * The operator new taking the allocator is not a template but a member of a class instantiated for the parameters
+ * of the coroutine, so that it is paired with the operator delete of the same class. The handle of the coroutine is
+ * made from this type, the actual type of the promise.
+ * </p>
+ */
+template <class T, class Allocator, class... Args>
+class __allocator_promise : public generator<T>::promise_type
+{
+public:
+    generator<T> get_return_object() noexcept
+    {
+        return this->return_object(*this);
+    }
+
+    static void* operator new(std::size_t size, std::allocator_arg_t, const Allocator& alloc, const Args&...)
+    {
+        return __frame_allocation::allocate(size, alloc);
+    }
+
+    static void operator delete(void* frame, std::size_t size) noexcept
+    {
+        __frame_allocation::deallocate(frame, size);
+    }
+};
+
+/** @brief Promise of a generator member function whose parameters are std::allocator_arg_t, an allocator and Args. */
+template <class T, class Class, class Allocator, class... Args>
+class __member_allocator_promise : public generator<T>::promise_type
+{
+public:
+    generator<T> get_return_object() noexcept
+    {
+        return this->return_object(*this);
+    }
+
+    static void* operator new(std::size_t size, const Class&, std::allocator_arg_t, const Allocator& alloc,
+        const Args&...)
+    {
+        return __frame_allocation::allocate(size, alloc);
+    }
+
+    static void operator delete(void* frame, std::size_t size) noexcept
+    {
+        __frame_allocation::deallocate(frame, size);
+    }
+};
+/// @endcond
+
+} // namespace __detail
+
+} // namespace stl_iterator
+
+namespace std {
+
+/// @cond DEV
+template <class T, class Allocator, class... Args>
+struct coroutine_traits<stl_iterator::generator<T>, allocator_arg_t, Allocator, Args...>
+{
+    using promise_type = stl_iterator::__detail::__allocator_promise<T, Allocator, Args...>;
+};
+
+template <class T, class Class, class Allocator, class... Args>
+struct coroutine_traits<stl_iterator::generator<T>, Class, allocator_arg_t, Allocator, Args...>
+{
+    using promise_type = stl_iterator::__detail::__member_allocator_promise<T, Class, Allocator, Args...>;
+};
+/// @endcond
+
+} // namespace std
+
+#endif // __STL_ITERATOR_HAS_GENERATOR
+
+#endif  // __STL_ITERATOR_GENERATOR_HPP__
@@ -0,0 +1,77 @@
+/** @file */
+#ifndef __STL_ITERATOR_ITERATOR_RANGE_HPP__
+#define __STL_ITERATOR_ITERATOR_RANGE_HPP__
+
+#include <iterator>
+#include <utility>
+#include "iterator/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief A pair of iterators [first, last) viewed as a range.
+ *
+ * <p>
+ * It does not own the elements. The range adaptors return it, so that adaptors can be stacked and the result can be
+ * passed to the algorithms through begin() and end().
+ * </p>
+ * @tparam Iterator - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ */
+template <class Iterator>
+class iterator_range
+{
+public:
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+    using value_type = __detail::__iterator_value_t<Iterator>;
+    using reference = __detail::__iterator_reference_t<Iterator>;
+    using difference_type = __detail::__iterator_difference_t<Iterator>;
+
+    iterator_range() = default;
+
+    iterator_range(Iterator first, Iterator last)
+        : first_(first)
+        , last_(last)
+    {}
+
+    iterator begin() const
+    {
+        return first_;
+    }
+
+    iterator end() const
+    {
+        return last_;
+    }
+
+    bool empty() const
+    {
+        return first_ == last_;
+    }
+
+private:
+    Iterator first_;
+    Iterator last_;
+};
+
+/**
+ * @brief Creates an iterator_range from [first, last).
+ */
+template <class Iterator>
+inline iterator_range<Iterator> make_iterator_range(Iterator first, Iterator last)
+{
+    return iterator_range<Iterator>(first, last);
+}
+
+namespace __detail {
+
+/// @cond DEV
+/** @brief Iterator type of a range. */
+template <class Range>
+using __range_iterator_t = decltype(std::begin(std::declval<Range&>()));
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_ITERATOR_RANGE_HPP__
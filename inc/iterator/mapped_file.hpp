@@ -0,0 +1,470 @@
+/** @file */
+#ifndef __STL_ITERATOR_MAPPED_FILE_HPP__
+#define __STL_ITERATOR_MAPPED_FILE_HPP__
+
+#if (defined __unix__) || (defined __APPLE__)
+#define __STL_ITERATOR_HAS_MAPPED_FILE 1
+#else
+#define __STL_ITERATOR_HAS_MAPPED_FILE 0
+#endif
+
+#if __STL_ITERATOR_HAS_MAPPED_FILE
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace stl_iterator {
+
+/**
+ * @brief Expected access pattern of a mapped file, which selects the hints given to the kernel with madvise.
+ */
+enum class access_pattern
+{
+    /** @brief A single pass from the beginning to the end: read ahead aggressively, drop pages behind. */
+    sequential,
+    /** @brief Accesses at arbitrary positions, such as searches in a sorted file: disable read ahead. */
+    random,
+    /** @brief Several passes over the whole file: load it at once and prefer huge pages where supported. */
+    repeated
+};
+
+namespace __detail {
+
+/// @cond DEV
+/** @brief Throws std::system_error for the last error of the function what. */
+inline void __throw_errno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/** @brief Read only file descriptor, closed on destruction. */
+class __readonly_file
+{
+public:
+    explicit __readonly_file(const std::string& path)
+        : fd_(::open(path.c_str(), O_RDONLY | O_CLOEXEC))
+    {
+        if (fd_ < 0) {
+            __throw_errno("open");
+        }
+    }
+
+    /** @brief Takes the ownership of the open file descriptor fd. */
+    explicit __readonly_file(int fd)
+        : fd_(fd)
+    {}
+
+    __readonly_file(const __readonly_file&) = delete;
+    __readonly_file& operator=(const __readonly_file&) = delete;
+
+    __readonly_file(__readonly_file&& other) noexcept
+        : fd_(other.fd_)
+    {
+        other.fd_ = -1;
+    }
+
+    __readonly_file& operator=(__readonly_file&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            fd_ = other.fd_;
+            other.fd_ = -1;
+        }
+        return *this;
+    }
+
+    ~__readonly_file()
+    {
+        reset();
+    }
+
+    int get() const
+    {
+        return fd_;
+    }
+
+    /** @brief Returns the size of the file in bytes. */
+    std::size_t size() const
+    {
+        struct ::stat st;
+        if (::fstat(fd_, &st) != 0) {
+            __throw_errno("fstat");
+        }
+        return static_cast<std::size_t>(st.st_size);
+    }
+
+private:
+    void reset() noexcept
+    {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    int fd_;
+};
+
+/**
+ * @brief Read only mapping of the bytes [offset, offset + length) of a file, unmapped on destruction.
+ *
+ * The mapping starts at the page boundary below offset, data() points to the byte at offset.
+ */
+class __readonly_mapping
+{
+public:
+    __readonly_mapping()
+        : base_(nullptr)
+        , length_(0)
+        , data_(nullptr)
+    {}
+
+    __readonly_mapping(int fd, std::size_t offset, std::size_t length)
+        : __readonly_mapping()
+    {
+        if (length == 0) {
+            return;
+        }
+        const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t aligned = offset / page * page;
+        void* base = ::mmap(nullptr, length + (offset - aligned), PROT_READ, MAP_SHARED, fd,
+            static_cast<::off_t>(aligned));
+        if (base == MAP_FAILED) {
+            __throw_errno("mmap");
+        }
+        base_ = base;
+        length_ = length + (offset - aligned);
+        data_ = static_cast<const unsigned char*>(base) + (offset - aligned);
+    }
+
+    __readonly_mapping(const __readonly_mapping&) = delete;
+    __readonly_mapping& operator=(const __readonly_mapping&) = delete;
+
+    __readonly_mapping(__readonly_mapping&& other) noexcept
+        : __readonly_mapping()
+    {
+        *this = std::move(other);
+    }
+
+    __readonly_mapping& operator=(__readonly_mapping&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            std::swap(base_, other.base_);
+            std::swap(length_, other.length_);
+            std::swap(data_, other.data_);
+        }
+        return *this;
+    }
+
+    ~__readonly_mapping()
+    {
+        reset();
+    }
+
+    /** @brief Unmaps the bytes. */
+    void reset() noexcept
+    {
+        if (base_ != nullptr) {
+            ::munmap(base_, length_);
+            base_ = nullptr;
+            length_ = 0;
+            data_ = nullptr;
+        }
+    }
+
+    const void* data() const
+    {
+        return data_;
+    }
+
+    /** @brief Gives the hints of pattern to the kernel, failures are ignored since hints are optional. */
+    void advise(access_pattern pattern) const
+    {
+        if (base_ == nullptr) {
+            return;
+        }
+        switch (pattern) {
+        case access_pattern::sequential:
+            ::madvise(base_, length_, MADV_SEQUENTIAL);
+            ::madvise(base_, length_, MADV_WILLNEED);
+            break;
+        case access_pattern::random:
+            ::madvise(base_, length_, MADV_RANDOM);
+            break;
+        case access_pattern::repeated:
+            ::madvise(base_, length_, MADV_WILLNEED);
+#if (defined MADV_HUGEPAGE)
+            ::madvise(base_, length_, MADV_HUGEPAGE);
+#endif
+            break;
+        }
+    }
+
+private:
+    void* base_;
+    std::size_t length_;
+    const unsigned char* data_;
+};
+/// @endcond
+
+} // namespace __detail
+
+/**
+ * @brief Read only range over the content of a file mapped in memory.
+ *
+ * <p>
+ * The iterators are pointers to the mapped elements, so every algorithm runs directly on the page cache without
+ * copying the file into a container. The hints given to the kernel are selected from the expected access pattern.
+ * <br/>
+ * The file is viewed as an array of T, trailing bytes which do not form a whole element are not part of the range.
+ * Errors of the system calls throw std::system_error.
+ * </p>
+ * @tparam T - element type, must be trivially copyable
+ */
+template <class T = char>
+class mapped_file_range
+{
+    static_assert(std::is_trivially_copyable<T>::value, "mapped_file_range requires trivially copyable elements");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = const T*;
+    using iterator = const_iterator;
+
+    /** @brief Constructs an empty range. */
+    mapped_file_range()
+        : mapping_()
+        , size_(0)
+    {}
+
+    /**
+     * @param path - path of the file to map
+     * @param pattern - expected access pattern
+     */
+    explicit mapped_file_range(const std::string& path, access_pattern pattern = access_pattern::sequential)
+        : mapped_file_range()
+    {
+        __detail::__readonly_file file(path);
+        size_ = file.size() / sizeof(T);
+        mapping_ = __detail::__readonly_mapping(file.get(), 0, size_ * sizeof(T));
+        mapping_.advise(pattern);
+    }
+
+    mapped_file_range(const mapped_file_range&) = delete;
+    mapped_file_range& operator=(const mapped_file_range&) = delete;
+
+    mapped_file_range(mapped_file_range&& other) noexcept
+        : mapping_(std::move(other.mapping_))
+        , size_(other.size_)
+    {
+        other.size_ = 0;
+    }
+
+    mapped_file_range& operator=(mapped_file_range&& other) noexcept
+    {
+        if (this != &other) {
+            mapping_ = std::move(other.mapping_);
+            size_ = other.size_;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /** @brief Changes the hints given to the kernel, such as before a second pass in a different order. */
+    void advise(access_pattern pattern) const
+    {
+        mapping_.advise(pattern);
+    }
+
+    const T* data() const
+    {
+        return static_cast<const T*>(mapping_.data());
+    }
+
+    iterator begin() const
+    {
+        return data();
+    }
+
+    iterator end() const
+    {
+        return data() + size_;
+    }
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+private:
+    __detail::__readonly_mapping mapping_;
+    size_type size_;
+};
+
+/**
+ * @brief Read only range over a window of a file mapped in memory, which slides over the file.
+ *
+ * <p>
+ * Only window_size elements are mapped at a time, which bounds the address space used for files larger than the
+ * budget of a process. next() maps the following window, consecutive windows share overlap elements so that a
+ * pattern of at most overlap + 1 elements crossing a boundary is found within a window.
+ * </p>
+ * ```
+ * stl_iterator::mapped_file_window<char> window(path, 1 << 28);
+ * std::ptrdiff_t lines = 0;
+ * do {
+ *     lines += stl_algorithm::count(window.begin(), window.end(), '\n');
+ * } while (window.next());
+ * ```
+ * @tparam T - element type, must be trivially copyable
+ */
+template <class T = char>
+class mapped_file_window
+{
+    static_assert(std::is_trivially_copyable<T>::value, "mapped_file_window requires trivially copyable elements");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = const T*;
+    using iterator = const_iterator;
+
+    /**
+     * @param path - path of the file to map
+     * @param window_size - number of elements mapped at a time, must be greater than overlap
+     * @param overlap - number of elements shared by two consecutive windows
+     * @param pattern - expected access pattern within a window
+     */
+    mapped_file_window(
+        const std::string& path,
+        size_type window_size,
+        size_type overlap = 0,
+        access_pattern pattern = access_pattern::sequential)
+        : file_(path)
+        , file_size_(file_.size() / sizeof(T))
+        , window_size_(window_size == 0 ? 1 : window_size)
+        , overlap_(overlap < window_size_ ? overlap : 0)
+        , pattern_(pattern)
+        , offset_(0)
+        , size_(0)
+        , mapping_()
+    {
+        map(0);
+    }
+
+    /**
+     * @brief Maps the window following the current one.
+     * @return false, leaving the current window mapped, if the current window reaches the end of the file
+     */
+    bool next()
+    {
+        if (offset_ + size_ >= file_size_) {
+            return false;
+        }
+        map(offset_ + size_ - overlap_);
+        return true;
+    }
+
+    /**
+     * @brief Maps the window starting at the element offset of the file.
+     * @param offset - index of the first element of the window, not greater than file_size()
+     * @throw std::out_of_range, leaving the current window mapped, if offset is greater than file_size()
+     */
+    void seek(size_type offset)
+    {
+        if (offset > file_size_) {
+            throw std::out_of_range("stl_iterator::mapped_file_window::seek");
+        }
+        map(offset);
+    }
+
+    /** @brief Returns the index in the file of the first element of the window. */
+    size_type offset() const
+    {
+        return offset_;
+    }
+
+    /** @brief Returns the number of elements in the file. */
+    size_type file_size() const
+    {
+        return file_size_;
+    }
+
+    /** @brief Returns the number of elements shared by two consecutive windows. */
+    size_type overlap() const
+    {
+        return overlap_;
+    }
+
+    const T* data() const
+    {
+        return static_cast<const T*>(mapping_.data());
+    }
+
+    iterator begin() const
+    {
+        return data();
+    }
+
+    iterator end() const
+    {
+        return data() + size_;
+    }
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+private:
+    void map(size_type offset)
+    {
+        const size_type size = std::min(window_size_, file_size_ - offset);
+        // The previous window is unmapped first, so that at most one window is mapped at a time.
+        mapping_.reset();
+        size_ = 0;
+        mapping_ = __detail::__readonly_mapping(file_.get(), offset * sizeof(T), size * sizeof(T));
+        mapping_.advise(pattern_);
+        offset_ = offset;
+        size_ = size;
+    }
+
+    __detail::__readonly_file file_;
+    size_type file_size_;
+    size_type window_size_;
+    size_type overlap_;
+    access_pattern pattern_;
+    size_type offset_;
+    size_type size_;
+    __detail::__readonly_mapping mapping_;
+};
+
+} // namespace stl_iterator
+
+#endif // __STL_ITERATOR_HAS_MAPPED_FILE
+
+#endif  // __STL_ITERATOR_MAPPED_FILE_HPP__
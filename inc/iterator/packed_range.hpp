@@ -0,0 +1,811 @@
+/** @file */
+#ifndef __STL_ITERATOR_PACKED_RANGE_HPP__
+#define __STL_ITERATOR_PACKED_RANGE_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "concept/signed_integral.hpp"
+#include "concept/unsigned_integral.hpp"
+#include "algorithm/detail/bit_ops.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/lane_kernel.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_iterator {
+
+/// @cond DEV
+namespace __detail {
+
+/** @brief Requirement of the element type of the packed ranges: SignedIntegral or UnsignedIntegral. */
+template <class T>
+using __PackedIntegral = typename std::conditional<
+    std::is_signed<T>::value,
+    stl_concept::SignedIntegral<T>,
+    stl_concept::UnsignedIntegral<T>>::type;
+
+/** @brief Number of elements per block of the packed ranges. */
+constexpr std::size_t __packed_block_size = 64;
+
+/**
+ * @brief Blocks of up to 64 unsigned fields of the same bit width, stored back to back in 64-bit words.
+ *
+ * Each block also keeps two 64-bit words whose meaning depends on the encoding.
+ */
+class __packed_blocks
+{
+public:
+    struct block
+    {
+        std::uint64_t base;
+        std::uint64_t reference;
+        std::size_t word;
+        unsigned width;
+    };
+
+    /** @brief Appends a block of n fields, whose width is the one of the largest field. */
+    void append(const std::uint64_t* fields, std::size_t n, std::uint64_t base, std::uint64_t reference)
+    {
+        std::uint64_t all = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            all |= fields[k];
+        }
+        const block b = {base, reference, words_.size(), stl_algorithm::__detail::__bit_width(all)};
+        words_.resize(words_.size() + (n * b.width + 63) / 64);
+        for (std::size_t k = 0, bit = 0; k < n; ++k, bit += b.width) {
+            store(b.word, bit, b.width, fields[k]);
+        }
+        blocks_.push_back(b);
+    }
+
+    const block& operator[](std::size_t i) const
+    {
+        return blocks_[i];
+    }
+
+    /** @brief Returns field k of block b. */
+    std::uint64_t field(const block& b, std::size_t k) const
+    {
+        if (b.width == 0) {
+            return 0;
+        }
+        const std::size_t bit = k * b.width;
+        return stl_algorithm::__detail::__load_bits(
+            words_.data() + b.word + bit / 64, static_cast<unsigned>(bit % 64), b.width);
+    }
+
+    /** @brief Returns the number of bytes used by the blocks. */
+    std::size_t memory_usage() const
+    {
+        return words_.size() * sizeof(std::uint64_t) + blocks_.size() * sizeof(block);
+    }
+
+private:
+    void store(std::size_t word, std::size_t bit, unsigned width, std::uint64_t value)
+    {
+        std::uint64_t* p = words_.data() + word + bit / 64;
+        const unsigned offset = static_cast<unsigned>(bit % 64);
+        if (width == 0) {
+            return;
+        }
+        p[0] |= value << offset;
+        if (offset + width > 64) {
+            p[1] |= value >> (64 - offset);
+        }
+    }
+
+    std::vector<std::uint64_t> words_;
+    std::vector<block> blocks_;
+};
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Forward iterator over the elements of a packed range, dereferenced to the decoded value.
+ *
+ * <p>
+ * It keeps the value of its element, so that incrementing it decodes a single field.
+ * </p>
+ * @tparam Range - stl_iterator::frame_of_reference_range or stl_iterator::delta_range
+ */
+template <class Range>
+class packed_iterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Range::value_type;
+    using reference = value_type;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+
+    packed_iterator()
+        : range_(nullptr)
+        , pos_(0)
+        , value_()
+    {}
+
+    packed_iterator(const Range* range, std::size_t pos)
+        : range_(range)
+        , pos_(pos)
+        , value_(pos < range->size() ? (*range)[pos] : value_type())
+    {}
+
+    /** @brief Returns the range of the element. */
+    const Range* range() const
+    {
+        return range_;
+    }
+
+    /** @brief Returns the position of the element in the range. */
+    std::size_t index() const
+    {
+        return pos_;
+    }
+
+    reference operator*() const
+    {
+        return value_;
+    }
+
+    packed_iterator& operator++()
+    {
+        if (++pos_ < range_->size()) {
+            value_ = range_->next(pos_, value_);
+        }
+        return *this;
+    }
+
+    packed_iterator operator++(int)
+    {
+        packed_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const packed_iterator& lhs, const packed_iterator& rhs)
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const packed_iterator& lhs, const packed_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    const Range* range_;
+    std::size_t pos_;
+    value_type value_;
+};
+
+/**
+ * @brief Immutable sequence of integers stored with frame of reference bit packing.
+ *
+ * <p>
+ * The elements are split in blocks of 64. A block keeps its minimum and the difference of each element to it, with
+ * the bit width of the largest difference.<br/>
+ * stl_algorithm::count_if, find and mismatch over its iterators decode one block at a time into a local buffer and test
+ * it without branches, stl_algorithm::count and find with a value compare the packed differences to the one of the
+ * value and skip the blocks which cannot hold it.
+ * </p>
+ * ```
+ * stl_iterator::frame_of_reference_range<std::int32_t> samples(values.begin(), values.end());
+ * auto n = stl_algorithm::count_if(samples.begin(), samples.end(), [](std::int32_t v) { return v > 1000; });
+ * ```
+ * @tparam T - must meet the requirements of <i>stl_concept::SignedIntegral</i> or
+ * <i>stl_concept::UnsignedIntegral</i>.
+ */
+template <class T>
+class frame_of_reference_range
+{
+    BOOST_CONCEPT_ASSERT((__detail::__PackedIntegral<T>));
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = packed_iterator<frame_of_reference_range>;
+    using iterator = const_iterator;
+
+    frame_of_reference_range()
+        : size_(0)
+    {}
+
+    /** @brief Encodes the elements of [first, last). */
+    template <class InputIt>
+    frame_of_reference_range(InputIt first, InputIt last)
+        : size_(0)
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<InputIt>));
+        T values[__detail::__packed_block_size];
+        std::size_t n = 0;
+        for (; first != last; ++first) {
+            values[n++] = *first;
+            if (n == __detail::__packed_block_size) {
+                append(values, n);
+                n = 0;
+            }
+        }
+        append(values, n);
+    }
+
+    frame_of_reference_range(std::initializer_list<T> init)
+        : frame_of_reference_range(init.begin(), init.end())
+    {}
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, size_);
+    }
+
+    /** @brief Returns the iterator to the element at position pos. */
+    const_iterator iterator_at(size_type pos) const
+    {
+        return const_iterator(this, pos);
+    }
+
+    /** @brief Returns the element at position pos, in O(1). */
+    T operator[](size_type pos) const
+    {
+        const auto& b = blocks_[pos / __detail::__packed_block_size];
+        return static_cast<T>(b.reference + blocks_.field(b, pos % __detail::__packed_block_size));
+    }
+
+    /** @brief Decodes the n elements starting at position pos into out. */
+    void decode(size_type pos, size_type n, T* out) const
+    {
+        for (size_type i = 0; i < n; ++i) {
+            out[i] = (*this)[pos + i];
+        }
+    }
+
+    /** @brief Returns the number of elements equal to value among the n elements starting at position pos. */
+    size_type count(size_type pos, size_type n, T value) const
+    {
+        size_type result = 0;
+        scan(pos, n, value, [&result](size_type, size_type matches) {
+            result += matches;
+            return true;
+        });
+        return result;
+    }
+
+    /**
+     * @brief Returns the offset of the first element equal to value among the n elements starting at position pos, n
+     * if there is none.
+     */
+    size_type find(size_type pos, size_type n, T value) const
+    {
+        size_type result = n;
+        scan(pos, n, value, [&result](size_type offset, size_type matches) {
+            if (matches == 0) {
+                return true;
+            }
+            result = offset;
+            return false;
+        });
+        return result;
+    }
+
+    /** @brief Returns the number of bytes used by the range. */
+    size_type memory_usage() const
+    {
+        return sizeof(*this) + blocks_.memory_usage();
+    }
+
+private:
+    friend const_iterator;
+
+    void append(const T* values, std::size_t n)
+    {
+        if (n == 0) {
+            return;
+        }
+        const T reference = *std::min_element(values, values + n);
+        std::uint64_t fields[__detail::__packed_block_size];
+        for (std::size_t k = 0; k < n; ++k) {
+            fields[k] = static_cast<std::uint64_t>(values[k]) - static_cast<std::uint64_t>(reference);
+        }
+        blocks_.append(fields, n, 0, static_cast<std::uint64_t>(reference));
+        size_ += n;
+    }
+
+    T next(size_type pos, T) const
+    {
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Calls f(offset, matches) for the blocks overlapping the n elements starting at pos, matches being the
+     * number of them equal to value in the block and offset the position of the first one, until f returns false.
+     */
+    template <class Function>
+    void scan(size_type pos, size_type n, T value, Function f) const
+    {
+        const size_type last = pos + n;
+        while (pos < last) {
+            const size_type i = pos / __detail::__packed_block_size;
+            const size_type end = std::min((i + 1) * __detail::__packed_block_size, last);
+            const auto& b = blocks_[i];
+            // Blocks whose range of values does not hold value are skipped without decoding.
+            const std::uint64_t target = static_cast<std::uint64_t>(value) - b.reference;
+            size_type matches = 0;
+            size_type first = end;
+            if (value >= static_cast<T>(b.reference) && target <= stl_algorithm::__detail::__low_mask(b.width)) {
+                for (size_type k = pos % __detail::__packed_block_size, j = pos; j < end; ++k, ++j) {
+                    const bool match = blocks_.field(b, k) == target;
+                    first = match && first == end ? j : first;
+                    matches += match;
+                }
+            }
+            if (!f(first - (last - n), matches)) {
+                return;
+            }
+            pos = end;
+        }
+    }
+
+    __detail::__packed_blocks blocks_;
+    size_type size_;
+};
+
+/**
+ * @brief Immutable sequence of integers stored as bit packed differences between consecutive elements.
+ *
+ * <p>
+ * The elements are split in blocks of 64. A block keeps its first element, the minimum difference between consecutive
+ * elements, and the excess of each difference over it, with the bit width of the largest excess. Slowly varying
+ * series, such as timestamps, take a few bits per element.<br/>
+ * stl_algorithm::count, count_if, find and mismatch over its iterators decode one block at a time into a local buffer
+ * and test it without branches.
+ * </p>
+ * ```
+ * stl_iterator::delta_range<std::uint64_t> timestamps(values.begin(), values.end());
+ * auto it = stl_algorithm::find(timestamps.begin(), timestamps.end(), t);
+ * ```
+ * @tparam T - must meet the requirements of <i>stl_concept::SignedIntegral</i> or
+ * <i>stl_concept::UnsignedIntegral</i>.
+ */
+template <class T>
+class delta_range
+{
+    BOOST_CONCEPT_ASSERT((__detail::__PackedIntegral<T>));
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = packed_iterator<delta_range>;
+    using iterator = const_iterator;
+
+    delta_range()
+        : size_(0)
+    {}
+
+    /** @brief Encodes the elements of [first, last). */
+    template <class InputIt>
+    delta_range(InputIt first, InputIt last)
+        : size_(0)
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<InputIt>));
+        T values[__detail::__packed_block_size];
+        std::size_t n = 0;
+        for (; first != last; ++first) {
+            values[n++] = *first;
+            if (n == __detail::__packed_block_size) {
+                append(values, n);
+                n = 0;
+            }
+        }
+        append(values, n);
+    }
+
+    delta_range(std::initializer_list<T> init)
+        : delta_range(init.begin(), init.end())
+    {}
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, size_);
+    }
+
+    /** @brief Returns the iterator to the element at position pos. */
+    const_iterator iterator_at(size_type pos) const
+    {
+        return const_iterator(this, pos);
+    }
+
+    /** @brief Returns the element at position pos, decoding its block up to it. */
+    T operator[](size_type pos) const
+    {
+        const auto& b = blocks_[pos / __detail::__packed_block_size];
+        std::uint64_t value = b.base;
+        for (size_type k = 1; k <= pos % __detail::__packed_block_size; ++k) {
+            value += b.reference + blocks_.field(b, k);
+        }
+        return static_cast<T>(value);
+    }
+
+    /** @brief Decodes the n elements starting at position pos into out. */
+    void decode(size_type pos, size_type n, T* out) const
+    {
+        for (size_type i = 0; i < n;) {
+            const auto& b = blocks_[(pos + i) / __detail::__packed_block_size];
+            size_type k = (pos + i) % __detail::__packed_block_size;
+            std::uint64_t value = static_cast<std::uint64_t>((*this)[pos + i]);
+            out[i++] = static_cast<T>(value);
+            for (++k; k < __detail::__packed_block_size && i < n; ++k) {
+                value += b.reference + blocks_.field(b, k);
+                out[i++] = static_cast<T>(value);
+            }
+        }
+    }
+
+    /** @brief Returns the number of bytes used by the range. */
+    size_type memory_usage() const
+    {
+        return sizeof(*this) + blocks_.memory_usage();
+    }
+
+private:
+    friend const_iterator;
+
+    void append(const T* values, std::size_t n)
+    {
+        if (n == 0) {
+            return;
+        }
+        std::uint64_t deltas[__detail::__packed_block_size] = {0};
+        std::int64_t reference = 0;
+        for (std::size_t k = 1; k < n; ++k) {
+            deltas[k] = static_cast<std::uint64_t>(values[k]) - static_cast<std::uint64_t>(values[k - 1]);
+            const std::int64_t delta = static_cast<std::int64_t>(deltas[k]);
+            reference = k == 1 ? delta : std::min(reference, delta);
+        }
+        for (std::size_t k = 1; k < n; ++k) {
+            deltas[k] -= static_cast<std::uint64_t>(reference);
+        }
+        blocks_.append(deltas, n, static_cast<std::uint64_t>(values[0]), static_cast<std::uint64_t>(reference));
+        size_ += n;
+    }
+
+    T next(size_type pos, T previous) const
+    {
+        const auto& b = blocks_[pos / __detail::__packed_block_size];
+        const size_type k = pos % __detail::__packed_block_size;
+        if (k == 0) {
+            return static_cast<T>(b.base);
+        }
+        return static_cast<T>(static_cast<std::uint64_t>(previous) + b.reference + blocks_.field(b, k));
+    }
+
+    __detail::__packed_blocks blocks_;
+    size_type size_;
+};
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+/**
+ * @brief Decodes [first, last) one block at a time and calls f(values, offset, n) for each decoded part, offset being
+ * its distance from first, until f returns false.
+ */
+template <class Range, class Function>
+inline void __for_each_packed_block(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    Function f)
+{
+    typename Range::value_type values[stl_iterator::__detail::__packed_block_size];
+    for (std::size_t pos = first.index(); pos < last.index();) {
+        const std::size_t end = std::min(
+            (pos / stl_iterator::__detail::__packed_block_size + 1) * stl_iterator::__detail::__packed_block_size,
+            last.index());
+        first.range()->decode(pos, end - pos, values);
+        if (!f(static_cast<const typename Range::value_type*>(values), pos - first.index(), end - pos)) {
+            return;
+        }
+        pos = end;
+    }
+}
+
+/** @brief Returns the offset of the first element of [first, last) for which p returns true, last - first if none. */
+template <class Range, class Predicate>
+inline std::size_t __packed_find_if(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    Predicate& p)
+{
+    std::size_t result = last.index() - first.index();
+    __for_each_packed_block(first, last, [&result, &p](
+        const typename Range::value_type* values, std::size_t offset, std::size_t n) {
+        std::uint64_t mask = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            mask |= static_cast<std::uint64_t>(static_cast<bool>(p(values[k]))) << k;
+        }
+        if (mask == 0) {
+            return true;
+        }
+        result = offset + __countr_zero(mask);
+        return false;
+    });
+    return result;
+}
+
+template <class Range, class Predicate>
+inline std::size_t __packed_count_if(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    Predicate& p)
+{
+    std::size_t result = 0;
+    __for_each_packed_block(first, last, [&result, &p](
+        const typename Range::value_type* values, std::size_t, std::size_t n) {
+        std::size_t hits = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            hits += static_cast<bool>(p(values[k]));
+        }
+        result += hits;
+        return true;
+    });
+    return result;
+}
+
+/**
+ * @brief Checks if the packed differences of a frame_of_reference_range can be compared to the ones of a value of type
+ * U, which is the case when U is an integral type.
+ */
+template <class Range, class U>
+struct __is_packed_comparable : std::false_type {};
+
+template <class T, class U>
+struct __is_packed_comparable<stl_iterator::frame_of_reference_range<T>, U> : std::is_integral<U> {};
+
+template <class T>
+inline bool __is_negative(T value, std::true_type)
+{
+    return value < 0;
+}
+
+template <class T>
+inline bool __is_negative(T, std::false_type)
+{
+    return false;
+}
+
+/** @brief Checks if the integral value is a value of T, otherwise no element is equal to it. */
+template <class T, class U>
+inline bool __is_representable(U value)
+{
+    const T converted = static_cast<T>(value);
+    return static_cast<U>(converted) == value &&
+        __is_negative(converted, std::is_signed<T>()) == __is_negative(value, std::is_signed<U>());
+}
+
+template <class T, class U>
+inline std::size_t __packed_count(
+    stl_iterator::packed_iterator<stl_iterator::frame_of_reference_range<T>> first,
+    stl_iterator::packed_iterator<stl_iterator::frame_of_reference_range<T>> last,
+    const U& value,
+    std::true_type)
+{
+    const std::size_t n = last.index() - first.index();
+    return __is_representable<T>(value) ? first.range()->count(first.index(), n, static_cast<T>(value)) : 0;
+}
+
+template <class Range, class U>
+inline std::size_t __packed_count(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    const U& value,
+    std::false_type)
+{
+    __equal_to_value<U> p{value};
+    return __packed_count_if(first, last, p);
+}
+
+template <class T, class U>
+inline std::size_t __packed_find(
+    stl_iterator::packed_iterator<stl_iterator::frame_of_reference_range<T>> first,
+    stl_iterator::packed_iterator<stl_iterator::frame_of_reference_range<T>> last,
+    const U& value,
+    std::true_type)
+{
+    const std::size_t n = last.index() - first.index();
+    return __is_representable<T>(value) ? first.range()->find(first.index(), n, static_cast<T>(value)) : n;
+}
+
+template <class Range, class U>
+inline std::size_t __packed_find(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    const U& value,
+    std::false_type)
+{
+    __equal_to_value<U> p{value};
+    return __packed_find_if(first, last, p);
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::count for frame_of_reference_range and delta_range.
+ *
+ * <p>
+ * A frame_of_reference_range compares the packed differences to the one of value and skips the blocks which cannot
+ * hold it, a delta_range decodes one block at a time.
+ * </p>
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class Range, class U>
+inline std::ptrdiff_t count(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class Range, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::packed_iterator<Range>>))
+        ((stl_concept::EqualityComparableWith<typename Range::value_type, U>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(stl_iterator::packed_iterator<Range> first, stl_iterator::packed_iterator<Range> last, const U& value)
+{
+    return static_cast<std::ptrdiff_t>(
+        __detail::__packed_count(first, last, value, __detail::__is_packed_comparable<Range, U>()));
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for frame_of_reference_range and delta_range, which decodes one block at a
+ * time and tests it without branches.
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Range, class UnaryPredicate>
+inline std::ptrdiff_t count_if(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Range, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::packed_iterator<Range>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::packed_iterator<Range>>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count_if(stl_iterator::packed_iterator<Range> first, stl_iterator::packed_iterator<Range> last, UnaryPredicate p)
+{
+    return static_cast<std::ptrdiff_t>(__detail::__packed_count_if(first, last, p));
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find for frame_of_reference_range and delta_range.
+ *
+ * <p>
+ * A frame_of_reference_range compares the packed differences to the one of value and skips the blocks which cannot
+ * hold it, a delta_range decodes one block at a time.
+ * </p>
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class Range, class U>
+inline stl_iterator::packed_iterator<Range> find(
+    stl_iterator::packed_iterator<Range> first,
+    stl_iterator::packed_iterator<Range> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class Range, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::packed_iterator<Range>>))
+        ((stl_concept::EqualityComparableWith<typename Range::value_type, U>)),
+        // Return
+        (stl_iterator::packed_iterator<Range>)
+    )
+inline find(stl_iterator::packed_iterator<Range> first, stl_iterator::packed_iterator<Range> last, const U& value)
+{
+    const std::size_t offset =
+        __detail::__packed_find(first, last, value, __detail::__is_packed_comparable<Range, U>());
+    return offset == last.index() - first.index() ? last : first.range()->iterator_at(first.index() + offset);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::mismatch for frame_of_reference_range and delta_range, which decodes the first
+ * range one block at a time.
+ * @see stl_algorithm::mismatch
+ */
+#ifdef DOXYGEN_WORKING
+template <class Range, class InputIt2>
+inline std::pair<stl_iterator::packed_iterator<Range>, InputIt2> mismatch(
+    stl_iterator::packed_iterator<Range> first1,
+    stl_iterator::packed_iterator<Range> last1,
+    InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class Range, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::packed_iterator<Range>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<typename Range::value_type, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<stl_iterator::packed_iterator<Range>, InputIt2>)
+    )
+inline mismatch(
+    stl_iterator::packed_iterator<Range> first1,
+    stl_iterator::packed_iterator<Range> last1,
+    InputIt2 first2)
+{
+    std::size_t result = last1.index() - first1.index();
+    __detail::__for_each_packed_block(first1, last1, [&result, &first2](
+        const typename Range::value_type* values, std::size_t offset, std::size_t n) {
+        for (std::size_t k = 0; k < n; ++k, ++first2) {
+            if (!(values[k] == *first2)) {
+                result = offset + k;
+                return false;
+            }
+        }
+        return true;
+    });
+    if (result == last1.index() - first1.index()) {
+        return std::make_pair(last1, first2);
+    }
+    return std::make_pair(first1.range()->iterator_at(first1.index() + result), first2);
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_PACKED_RANGE_HPP__
@@ -0,0 +1,530 @@
+/** @file */
+#ifndef __STL_ITERATOR_RLE_RANGE_HPP__
+#define __STL_ITERATOR_RLE_RANGE_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/concept/requires.hpp>
+#include "concept/copy_constructible.hpp"
+#include "concept/equality_comparable.hpp"
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_iterator {
+
+template <class T>
+class rle_range;
+
+/**
+ * @brief Forward iterator over the elements of a rle_range.
+ *
+ * <p>
+ * It knows the run of its element, so that the overloads of the algorithms for rle_range process whole runs.
+ * </p>
+ * @tparam T - value type
+ */
+template <class T>
+class rle_iterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using reference = const T&;
+    using pointer = const T*;
+    using difference_type = std::ptrdiff_t;
+
+    rle_iterator()
+        : range_(nullptr)
+        , run_(0)
+        , pos_(0)
+    {}
+
+    rle_iterator(const rle_range<T>* range, std::size_t run, std::size_t pos)
+        : range_(range)
+        , run_(run)
+        , pos_(pos)
+    {}
+
+    /** @brief Returns the range of the element. */
+    const rle_range<T>* range() const
+    {
+        return range_;
+    }
+
+    /** @brief Returns the index of the run of the element. */
+    std::size_t run() const
+    {
+        return run_;
+    }
+
+    /** @brief Returns the position of the element in the range. */
+    std::size_t index() const
+    {
+        return pos_;
+    }
+
+    reference operator*() const
+    {
+        return range_->run_value(run_);
+    }
+
+    pointer operator->() const
+    {
+        return &range_->run_value(run_);
+    }
+
+    rle_iterator& operator++()
+    {
+        if (++pos_ == range_->run_end(run_)) {
+            ++run_;
+        }
+        return *this;
+    }
+
+    rle_iterator operator++(int)
+    {
+        rle_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const rle_iterator& lhs, const rle_iterator& rhs)
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const rle_iterator& lhs, const rle_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    const rle_range<T>* range_;
+    std::size_t run_;
+    std::size_t pos_;
+};
+
+/**
+ * @brief Immutable sequence stored as runs of equal values, each run being a value and the position after its last
+ * element.
+ *
+ * <p>
+ * A sequence of n elements with r runs takes r values and r positions. stl_algorithm::count, count_if, find, all_of,
+ * any_of, none_of, equal and mismatch over its iterators process one run at a time: count adds the length of the
+ * matching runs, the predicates are applied once per run.
+ * </p>
+ * ```
+ * stl_iterator::rle_range<int> column(values.begin(), values.end());
+ * auto n = stl_algorithm::count(column.begin(), column.end(), 0);
+ * ```
+ * @tparam T - must meet the requirements of <i>stl_concept::CopyConstructible</i> and
+ * <i>stl_concept::EqualityComparable</i>.
+ */
+template <class T>
+class rle_range
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyConstructible<T>));
+    BOOST_CONCEPT_ASSERT((stl_concept::EqualityComparable<T>));
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = rle_iterator<T>;
+    using iterator = const_iterator;
+
+    rle_range() = default;
+
+    /** @brief Encodes the elements of [first, last). */
+    template <class InputIt>
+    rle_range(InputIt first, InputIt last)
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<InputIt>));
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    rle_range(std::initializer_list<T> init)
+        : rle_range(init.begin(), init.end())
+    {}
+
+    /** @brief Appends n copies of value, extending the last run if it has the same value. */
+    void push_back(const T& value, size_type n = 1)
+    {
+        if (n == 0) {
+            return;
+        }
+        if (values_.empty() || !(values_.back() == value)) {
+            values_.push_back(value);
+            ends_.push_back(size());
+        }
+        ends_.back() += n;
+    }
+
+    size_type size() const
+    {
+        return ends_.empty() ? 0 : ends_.back();
+    }
+
+    bool empty() const
+    {
+        return ends_.empty();
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, ends_.size(), size());
+    }
+
+    /** @brief Returns the number of runs. */
+    size_type run_count() const
+    {
+        return values_.size();
+    }
+
+    /** @brief Returns the value of run r. */
+    const T& run_value(size_type r) const
+    {
+        return values_[r];
+    }
+
+    /** @brief Returns the position of the first element of run r. */
+    size_type run_begin(size_type r) const
+    {
+        return r == 0 ? 0 : ends_[r - 1];
+    }
+
+    /** @brief Returns the position after the last element of run r. */
+    size_type run_end(size_type r) const
+    {
+        return ends_[r];
+    }
+
+    /** @brief Returns the iterator to the element at position pos, in O(log r). */
+    const_iterator iterator_at(size_type pos) const
+    {
+        const size_type run = static_cast<size_type>(std::upper_bound(ends_.begin(), ends_.end(), pos) - ends_.begin());
+        return const_iterator(this, run, pos);
+    }
+
+    friend bool operator==(const rle_range& lhs, const rle_range& rhs)
+    {
+        return lhs.ends_ == rhs.ends_ && lhs.values_ == rhs.values_;
+    }
+
+    friend bool operator!=(const rle_range& lhs, const rle_range& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::vector<T> values_;
+    std::vector<size_type> ends_;
+};
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+/**
+ * @brief Calls f(value, offset, length) for the part of each run in [first, last), offset being the distance from
+ * first to the part, until f returns false.
+ * @return offset of the part for which f returned false, last - first if there is none
+ */
+template <class T, class Function>
+inline std::size_t __for_each_run(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, Function f)
+{
+    const stl_iterator::rle_range<T>* range = first.range();
+    for (std::size_t r = first.run(), pos = first.index(); pos < last.index(); pos = range->run_end(r++)) {
+        const std::size_t length = std::min(range->run_end(r), last.index()) - pos;
+        if (!f(range->run_value(r), pos - first.index(), length)) {
+            return pos - first.index();
+        }
+    }
+    return last.index() - first.index();
+}
+
+template <class T>
+inline stl_iterator::rle_iterator<T> __rle_advance(stl_iterator::rle_iterator<T> first, std::size_t n)
+{
+    return n == 0 ? first : first.range()->iterator_at(first.index() + n);
+}
+
+template <class T, class U>
+inline std::pair<stl_iterator::rle_iterator<T>, stl_iterator::rle_iterator<U>> __rle_mismatch(
+    stl_iterator::rle_iterator<T> first1,
+    stl_iterator::rle_iterator<T> last1,
+    stl_iterator::rle_iterator<U> first2,
+    std::true_type)
+{
+    // Walks the runs of both ranges together, comparing the values once per overlapping part.
+    const stl_iterator::rle_range<T>& range1 = *first1.range();
+    const stl_iterator::rle_range<U>& range2 = *first2.range();
+    std::size_t r1 = first1.run();
+    std::size_t r2 = first2.run();
+    std::size_t offset = 0;
+    const std::size_t n = last1.index() - first1.index();
+    while (offset < n) {
+        if (!(range1.run_value(r1) == range2.run_value(r2))) {
+            break;
+        }
+        const std::size_t end1 = range1.run_end(r1) - first1.index();
+        const std::size_t end2 = range2.run_end(r2) - first2.index();
+        offset = std::min(std::min(end1, end2), n);
+        if (offset == end1) {
+            ++r1;
+        }
+        if (offset == end2) {
+            ++r2;
+        }
+    }
+    return std::make_pair(__rle_advance(first1, offset), __rle_advance(first2, offset));
+}
+
+template <class T, class InputIt2>
+inline std::pair<stl_iterator::rle_iterator<T>, InputIt2> __rle_mismatch(
+    stl_iterator::rle_iterator<T> first1,
+    stl_iterator::rle_iterator<T> last1,
+    InputIt2 first2,
+    std::false_type)
+{
+    return std::mismatch(first1, last1, first2);
+}
+
+template <class Iterator>
+struct __is_rle_iterator : std::false_type {};
+
+template <class T>
+struct __is_rle_iterator<stl_iterator::rle_iterator<T>> : std::true_type {};
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::count for rle_range, which compares value once per run and adds the length of
+ * the matching runs.
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class U>
+inline std::ptrdiff_t count(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((stl_concept::EqualityComparableWith<T, U>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, const U& value)
+{
+    std::size_t result = 0;
+    __detail::__for_each_run(first, last, [&result, &value](const T& v, std::size_t, std::size_t length) {
+        if (v == value) {
+            result += length;
+        }
+        return true;
+    });
+    return static_cast<std::ptrdiff_t>(result);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for rle_range, which applies p once per run and adds the length of the
+ * matching runs.
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline std::ptrdiff_t count_if(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::rle_iterator<T>>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count_if(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p)
+{
+    std::size_t result = 0;
+    __detail::__for_each_run(first, last, [&result, &p](const T& v, std::size_t, std::size_t length) {
+        if (p(v)) {
+            result += length;
+        }
+        return true;
+    });
+    return static_cast<std::ptrdiff_t>(result);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find for rle_range, which compares value once per run.
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class U>
+inline stl_iterator::rle_iterator<T> find(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((stl_concept::EqualityComparableWith<T, U>)),
+        // Return
+        (stl_iterator::rle_iterator<T>)
+    )
+inline find(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, const U& value)
+{
+    const std::size_t offset = __detail::__for_each_run(first, last, [&value](const T& v, std::size_t, std::size_t) {
+        return !(v == value);
+    });
+    return __detail::__rle_advance(first, offset);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::all_of for rle_range, which applies p once per run.
+ * @see stl_algorithm::all_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline bool all_of(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::rle_iterator<T>>)),
+        // Return
+        (bool)
+    )
+inline all_of(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p)
+{
+    return __detail::__for_each_run(first, last, [&p](const T& v, std::size_t, std::size_t) {
+        return static_cast<bool>(p(v));
+    }) == last.index() - first.index();
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for rle_range, which applies p once per run.
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline bool any_of(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::rle_iterator<T>>)),
+        // Return
+        (bool)
+    )
+inline any_of(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p)
+{
+    return __detail::__for_each_run(first, last, [&p](const T& v, std::size_t, std::size_t) {
+        return !p(v);
+    }) != last.index() - first.index();
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::none_of for rle_range, which applies p once per run.
+ * @see stl_algorithm::none_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline bool none_of(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::rle_iterator<T>>)),
+        // Return
+        (bool)
+    )
+inline none_of(stl_iterator::rle_iterator<T> first, stl_iterator::rle_iterator<T> last, UnaryPredicate p)
+{
+    return __detail::__for_each_run(first, last, [&p](const T& v, std::size_t, std::size_t) {
+        return !p(v);
+    }) == last.index() - first.index();
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::mismatch for rle_range, which compares the values once per overlapping part of
+ * the runs when the second range is also a rle_range.
+ * @see stl_algorithm::mismatch
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class InputIt2>
+inline std::pair<stl_iterator::rle_iterator<T>, InputIt2> mismatch(stl_iterator::rle_iterator<T> first1,
+    stl_iterator::rle_iterator<T> last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class T, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<T, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (std::pair<stl_iterator::rle_iterator<T>, InputIt2>)
+    )
+inline mismatch(stl_iterator::rle_iterator<T> first1, stl_iterator::rle_iterator<T> last1, InputIt2 first2)
+{
+    return __detail::__rle_mismatch(first1, last1, first2, __detail::__is_rle_iterator<InputIt2>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::equal for rle_range, which compares the values once per overlapping part of the
+ * runs when the second range is also a rle_range.
+ * @see stl_algorithm::equal
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class InputIt2>
+inline bool equal(stl_iterator::rle_iterator<T> first1, stl_iterator::rle_iterator<T> last1, InputIt2 first2);
+#else // DOXYGEN_WORKING
+template <class T, class InputIt2>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::rle_iterator<T>>))
+        ((stl_concept::InputIterator<InputIt2>))
+        ((stl_concept::EqualityComparableWith<T, __detail::__iterator_value_t<InputIt2>>)),
+        // Return
+        (bool)
+    )
+inline equal(stl_iterator::rle_iterator<T> first1, stl_iterator::rle_iterator<T> last1, InputIt2 first2)
+{
+    return __detail::__rle_mismatch(first1, last1, first2, __detail::__is_rle_iterator<InputIt2>()).first == last1;
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_RLE_RANGE_HPP__
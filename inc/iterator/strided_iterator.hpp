@@ -0,0 +1,458 @@
+/** @file */
+#ifndef __STL_ITERATOR_STRIDED_ITERATOR_HPP__
+#define __STL_ITERATOR_STRIDED_ITERATOR_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <boost/concept/requires.hpp>
+#include "concept/equality_comparable_with.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/lane_kernel.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief Random access iterator over elements placed at a fixed distance in memory.
+ *
+ * <p>
+ * It walks a pointer by a fixed number of bytes, such as a single field of an array of structs or every k-th sample
+ * of an interleaved signal, without copying the elements into a temporary container.<br/>
+ * The stride is given in bytes and must not be zero.
+ * </p>
+ * @tparam T - element type, may be const qualified
+ */
+template <class T>
+class strided_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename std::remove_cv<T>::type;
+    using reference = T&;
+    using pointer = T*;
+    using difference_type = std::ptrdiff_t;
+
+    strided_iterator()
+        : ptr_(nullptr)
+        , stride_(static_cast<difference_type>(sizeof(T)))
+    {}
+
+    /**
+     * @param ptr - pointer to the first element
+     * @param stride - distance in bytes between two consecutive elements
+     */
+    strided_iterator(T* ptr, difference_type stride)
+        : ptr_(ptr)
+        , stride_(stride)
+    {}
+
+    /** @brief Returns the pointer to the current element. */
+    pointer base() const
+    {
+        return ptr_;
+    }
+
+    /** @brief Returns the distance in bytes between two consecutive elements. */
+    difference_type stride() const
+    {
+        return stride_;
+    }
+
+    reference operator*() const
+    {
+        return *ptr_;
+    }
+
+    pointer operator->() const
+    {
+        return ptr_;
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return *at(n);
+    }
+
+    strided_iterator& operator++()
+    {
+        ptr_ = at(1);
+        return *this;
+    }
+
+    strided_iterator operator++(int)
+    {
+        strided_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    strided_iterator& operator--()
+    {
+        ptr_ = at(-1);
+        return *this;
+    }
+
+    strided_iterator operator--(int)
+    {
+        strided_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    strided_iterator& operator+=(difference_type n)
+    {
+        ptr_ = at(n);
+        return *this;
+    }
+
+    strided_iterator& operator-=(difference_type n)
+    {
+        ptr_ = at(-n);
+        return *this;
+    }
+
+    friend strided_iterator operator+(strided_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend strided_iterator operator+(difference_type n, strided_iterator it)
+    {
+        return it += n;
+    }
+
+    friend strided_iterator operator-(strided_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return (lhs.bytes() - rhs.bytes()) / lhs.stride_;
+    }
+
+    friend bool operator==(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return lhs.ptr_ == rhs.ptr_;
+    }
+
+    friend bool operator!=(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return (lhs - rhs) < 0;
+    }
+
+    friend bool operator>(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const strided_iterator& lhs, const strided_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    using __Byte = typename std::conditional<std::is_const<T>::value, const char, char>::type;
+
+    pointer at(difference_type n) const
+    {
+        return reinterpret_cast<pointer>(reinterpret_cast<__Byte*>(ptr_) + n * stride_);
+    }
+
+    difference_type bytes() const
+    {
+        return static_cast<difference_type>(reinterpret_cast<std::uintptr_t>(ptr_));
+    }
+
+    pointer ptr_;
+    difference_type stride_;
+};
+
+/**
+ * @brief Creates a strided_iterator visiting every step-th element starting from ptr.
+ * @param ptr - pointer to the first element
+ * @param step - distance in elements between two consecutive visited elements
+ */
+template <class T>
+inline strided_iterator<T> make_strided_iterator(T* ptr, std::ptrdiff_t step)
+{
+    return strided_iterator<T>(ptr, step * static_cast<std::ptrdiff_t>(sizeof(T)));
+}
+
+/**
+ * @brief Creates a strided_iterator visiting the given data member of consecutive objects starting from object.
+ * @param object - pointer to the first object of an array
+ * @param member - pointer to the data member to be visited
+ */
+template <class S, class M>
+inline strided_iterator<M> make_member_iterator(S* object, M S::*member)
+{
+    return strided_iterator<M>(&(object->*member), static_cast<std::ptrdiff_t>(sizeof(S)));
+}
+
+/** @overload */
+template <class S, class M>
+inline strided_iterator<const M> make_member_iterator(const S* object, M S::*member)
+{
+    return strided_iterator<const M>(&(object->*member), static_cast<std::ptrdiff_t>(sizeof(S)));
+}
+
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+template <class T>
+using __strided_lane_tag = __is_lane_gatherable<stl_iterator::strided_iterator<T>>;
+
+template <class T, class Predicate>
+inline std::ptrdiff_t __strided_find_if(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, Predicate& p,
+    std::true_type)
+{
+    return __lane_find_if(first, n, p);
+}
+
+template <class T, class Predicate>
+inline std::ptrdiff_t __strided_find_if(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, Predicate& p,
+    std::false_type)
+{
+    return std::find_if(first, first + n, std::ref(p)) - first;
+}
+
+template <class T, class Predicate>
+inline std::ptrdiff_t __strided_count_if(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, Predicate& p,
+    std::true_type)
+{
+    return __lane_count_if(first, n, p);
+}
+
+template <class T, class Predicate>
+inline std::ptrdiff_t __strided_count_if(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, Predicate& p,
+    std::false_type)
+{
+    return std::count_if(first, first + n, std::ref(p));
+}
+
+template <class T, class U>
+inline std::ptrdiff_t __strided_find(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, const U& value,
+    std::false_type)
+{
+    __equal_to_value<U> p{value};
+    return __strided_find_if(first, n, p, __strided_lane_tag<T>());
+}
+
+template <class T, class U>
+inline std::ptrdiff_t __strided_count(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, const U& value,
+    std::false_type)
+{
+    __equal_to_value<U> p{value};
+    return __strided_count_if(first, n, p, __strided_lane_tag<T>());
+}
+
+#if (defined __AVX2__)
+/** @brief Checks if the 32-bit gather offsets of a block of lanes fit in the stride of first. */
+template <class T>
+inline bool __is_avx2_gather_stride(const stl_iterator::strided_iterator<T>& first)
+{
+    return first.stride() % 4 == 0 &&
+        first.stride() / 4 <= std::numeric_limits<std::int32_t>::max() / __lane_count &&
+        first.stride() / 4 >= std::numeric_limits<std::int32_t>::min() / __lane_count;
+}
+
+template <class T, class U>
+inline std::ptrdiff_t __strided_find(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, const U& value,
+    std::true_type)
+{
+    if (!__is_avx2_gather_stride(first)) {
+        return __strided_find(first, n, value, std::false_type());
+    }
+    const auto stride = static_cast<std::int32_t>(first.stride() / 4);
+    std::ptrdiff_t i = 0;
+    for (; i + __lane_count <= n; i += __lane_count) {
+        unsigned mask = __avx2_gather_equal_mask(&first[i], stride, static_cast<std::int32_t>(value));
+        if (mask) {
+            return i + __first_lane(mask);
+        }
+    }
+    return i + __strided_find(first + i, n - i, value, std::false_type());
+}
+
+template <class T, class U>
+inline std::ptrdiff_t __strided_count(stl_iterator::strided_iterator<T> first, std::ptrdiff_t n, const U& value,
+    std::true_type)
+{
+    if (!__is_avx2_gather_stride(first)) {
+        return __strided_count(first, n, value, std::false_type());
+    }
+    const auto stride = static_cast<std::int32_t>(first.stride() / 4);
+    std::ptrdiff_t count = 0;
+    std::ptrdiff_t i = 0;
+    for (; i + __lane_count <= n; i += __lane_count) {
+        count += __lane_mask_count(__avx2_gather_equal_mask(&first[i], stride, static_cast<std::int32_t>(value)));
+    }
+    return count + __strided_count(first + i, n - i, value, std::false_type());
+}
+
+template <class T, class U>
+using __strided_kernel_tag = __is_avx2_gather_int32<T, U>;
+#else // __AVX2__
+template <class T, class U>
+using __strided_kernel_tag = std::false_type;
+#endif // __AVX2__
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::find for strided_iterator ranges.
+ *
+ * <p>
+ * Trivial elements are gathered a block of lanes at a time and compared without branches.<br/>
+ * When compiled for AVX2, 32-bit integral elements are loaded with hardware gather instructions.
+ * </p>
+ * @see stl_algorithm::find
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class U>
+inline stl_iterator::strided_iterator<T> find(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::strided_iterator<T>>))
+        ((stl_concept::EqualityComparableWith<typename std::remove_cv<T>::type, U>)),
+        // Return
+        (stl_iterator::strided_iterator<T>)
+    )
+inline find(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    const U& value)
+{
+    return first + __detail::__strided_find(first, last - first, value, __detail::__strided_kernel_tag<T, U>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count for strided_iterator ranges.
+ *
+ * <p>
+ * Trivial elements are gathered a block of lanes at a time and compared without branches.<br/>
+ * When compiled for AVX2, 32-bit integral elements are loaded with hardware gather instructions.
+ * </p>
+ * @see stl_algorithm::count
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class U>
+inline std::ptrdiff_t count(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    const U& value);
+#else // DOXYGEN_WORKING
+template <class T, class U>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::strided_iterator<T>>))
+        ((stl_concept::EqualityComparableWith<typename std::remove_cv<T>::type, U>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    const U& value)
+{
+    return __detail::__strided_count(first, last - first, value, __detail::__strided_kernel_tag<T, U>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for strided_iterator ranges.
+ *
+ * <p>
+ * Trivial elements are gathered a block of lanes at a time and tested without branches, other elements are tested
+ * in place.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline std::ptrdiff_t count_if(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::strided_iterator<T>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::strided_iterator<T>>)),
+        // Return
+        (std::ptrdiff_t)
+    )
+inline count_if(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    UnaryPredicate p)
+{
+    return __detail::__strided_count_if(first, last - first, p, __detail::__strided_lane_tag<T>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if for strided_iterator ranges.
+ *
+ * <p>
+ * Trivial elements are gathered a block of lanes at a time, other elements are tested in place. The predicate is not
+ * called on the elements after the one found.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+inline stl_iterator::strided_iterator<T> find_if(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class T, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::strided_iterator<T>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::strided_iterator<T>>)),
+        // Return
+        (stl_iterator::strided_iterator<T>)
+    )
+inline find_if(
+    stl_iterator::strided_iterator<T> first,
+    stl_iterator::strided_iterator<T> last,
+    UnaryPredicate p)
+{
+    return first + __detail::__strided_find_if(first, last - first, p, __detail::__strided_lane_tag<T>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_STRIDED_ITERATOR_HPP__
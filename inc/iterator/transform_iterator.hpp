@@ -0,0 +1,434 @@
+/** @file */
+#ifndef __STL_ITERATOR_TRANSFORM_ITERATOR_HPP__
+#define __STL_ITERATOR_TRANSFORM_ITERATOR_HPP__
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <boost/concept/requires.hpp>
+#include "concept/input_iterator.hpp"
+#include "concept/detail/remove_cvref.hpp"
+#include "algorithm/detail/iterator_traits.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+#include "iterator/iterator_range.hpp"
+#include "iterator/detail/function_box.hpp"
+#include "iterator/detail/fusion.hpp"
+#include "iterator/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief Iterator adapter which lazily applies a function to the elements of the adapted range on dereference.
+ *
+ * <p>
+ * No element is copied, so a transform stage in a pipeline does not materialize an intermediate container.<br/>
+ * The reference type is the result type of the function, the iterator category is the category of Iterator.
+ * </p>
+ * @tparam Function - must meet the requirements of <i>stl_concept::UnaryFunction</i>.
+ * @tparam Iterator - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ */
+template <class Function, class Iterator>
+class transform_iterator
+{
+public:
+    using iterator_category = __detail::__iterator_category_t<Iterator>;
+    using reference = decltype(std::declval<Function&>()(std::declval<__detail::__iterator_reference_t<Iterator>>()));
+    using value_type = stl_concept::__detail::__remove_cvref_t<reference>;
+    using pointer = void;
+    using difference_type = __detail::__iterator_difference_t<Iterator>;
+
+    transform_iterator() = default;
+
+    /**
+     * @param f - function to be applied on dereference
+     * @param it - position in the adapted range
+     */
+    transform_iterator(Function f, Iterator it)
+        : func_(f)
+        , iter_(it)
+    {}
+
+    /** @brief Returns the current position in the adapted range. */
+    const Iterator& base() const
+    {
+        return iter_;
+    }
+
+    /** @brief Returns the function. */
+    const Function& function() const
+    {
+        return func_.get();
+    }
+
+    reference operator*() const
+    {
+        return func_.get()(*iter_);
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return func_.get()(iter_[n]);
+    }
+
+    transform_iterator& operator++()
+    {
+        ++iter_;
+        return *this;
+    }
+
+    transform_iterator operator++(int)
+    {
+        transform_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    transform_iterator& operator--()
+    {
+        --iter_;
+        return *this;
+    }
+
+    transform_iterator operator--(int)
+    {
+        transform_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    transform_iterator& operator+=(difference_type n)
+    {
+        iter_ += n;
+        return *this;
+    }
+
+    transform_iterator& operator-=(difference_type n)
+    {
+        iter_ -= n;
+        return *this;
+    }
+
+    friend transform_iterator operator+(transform_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend transform_iterator operator+(difference_type n, transform_iterator it)
+    {
+        return it += n;
+    }
+
+    friend transform_iterator operator-(transform_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return lhs.iter_ - rhs.iter_;
+    }
+
+    friend bool operator==(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return lhs.iter_ == rhs.iter_;
+    }
+
+    friend bool operator!=(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return lhs.iter_ < rhs.iter_;
+    }
+
+    friend bool operator>(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const transform_iterator& lhs, const transform_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    __detail::__function_box<Function> func_;
+    Iterator iter_;
+};
+
+/**
+ * @brief Creates a transform_iterator applying f on dereference of it.
+ */
+template <class Function, class Iterator>
+inline transform_iterator<Function, Iterator> make_transform_iterator(Function f, Iterator it)
+{
+    return transform_iterator<Function, Iterator>(f, it);
+}
+
+/**
+ * @brief Lazy view of the results of f applied on the elements of range.
+ * @param range - range to be adapted, it must outlive the returned view
+ * @param f - function to be applied on dereference
+ * @return iterator_range of transform_iterator
+ */
+template <class Range, class Function>
+inline iterator_range<transform_iterator<Function, __detail::__range_iterator_t<Range>>>
+transformed(Range& range, Function f)
+{
+    using __Iterator = transform_iterator<Function, __detail::__range_iterator_t<Range>>;
+    return iterator_range<__Iterator>(__Iterator(f, std::begin(range)), __Iterator(f, std::end(range)));
+}
+
+/** @overload */
+template <class Range, class Function>
+inline iterator_range<transform_iterator<Function, __detail::__range_iterator_t<const Range>>>
+transformed(const Range& range, Function f)
+{
+    using __Iterator = transform_iterator<Function, __detail::__range_iterator_t<const Range>>;
+    return iterator_range<__Iterator>(__Iterator(f, std::begin(range)), __Iterator(f, std::end(range)));
+}
+
+namespace __detail {
+
+/// @cond DEV
+template <class Function, class Iterator>
+struct __fusion<transform_iterator<Function, Iterator>>
+{
+    using __Inner = __fusion<Iterator>;
+    using base_iterator = typename __Inner::base_iterator;
+
+    static base_iterator base(const transform_iterator<Function, Iterator>& it)
+    {
+        return __Inner::base(it.base());
+    }
+
+    template <class P>
+    static auto predicate(const transform_iterator<Function, Iterator>& it, P p)
+        -> decltype(__Inner::predicate(it.base(), __composed_function<P, Function>{std::move(p), it.function()}))
+    {
+        return __Inner::predicate(it.base(), __composed_function<P, Function>{std::move(p), it.function()});
+    }
+
+    static transform_iterator<Function, Iterator> rebind(
+        const transform_iterator<Function, Iterator>& it,
+        base_iterator b)
+    {
+        return transform_iterator<Function, Iterator>(it.function(), __Inner::rebind(it.base(), b));
+    }
+};
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/**
+ * @brief Overload of stl_algorithm::find_if for transform_iterator ranges.
+ *
+ * <p>
+ * Returns the first element of the view for which p returns true.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+inline stl_iterator::transform_iterator<Function, Iterator> find_if(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::transform_iterator<Function, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::transform_iterator<Function, Iterator>>)),
+        // Return
+        (stl_iterator::transform_iterator<Function, Iterator>)
+    )
+inline find_if(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if_not for transform_iterator ranges.
+ *
+ * <p>
+ * Returns the first element of the view for which p returns false.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::find_if_not
+ */
+#ifdef DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+inline stl_iterator::transform_iterator<Function, Iterator> find_if_not(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::transform_iterator<Function, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::transform_iterator<Function, Iterator>>)),
+        // Return
+        (stl_iterator::transform_iterator<Function, Iterator>)
+    )
+inline find_if_not(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if_not(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for transform_iterator ranges.
+ *
+ * <p>
+ * Returns the number of elements of the view for which p returns true.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+inline auto count_if(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+    -> decltype(typename std::iterator_traits<stl_iterator::transform_iterator<Function, Iterator>>::difference_type);
+#else // DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::transform_iterator<Function, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::transform_iterator<Function, Iterator>>)),
+        // Return
+        (__detail::__iterator_difference_t<stl_iterator::transform_iterator<Function, Iterator>>)
+    )
+inline count_if(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_count_if(first, last, p);
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::all_of for transform_iterator ranges.
+ *
+ * <p>
+ * Checks if p returns true for all elements of the view.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::all_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+inline bool all_of(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::transform_iterator<Function, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::transform_iterator<Function, Iterator>>)),
+        // Return
+        (bool)
+    )
+inline all_of(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if_not(first, last, p) == last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for transform_iterator ranges.
+ *
+ * <p>
+ * Checks if p returns true for at least one element of the view.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+inline bool any_of(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::transform_iterator<Function, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::transform_iterator<Function, Iterator>>)),
+        // Return
+        (bool)
+    )
+inline any_of(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if(first, last, p) != last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::none_of for transform_iterator ranges.
+ *
+ * <p>
+ * Checks if p returns true for no elements of the view.<br/>
+ * The view is flattened into a single loop over the adapted range.
+ * </p>
+ * @see stl_algorithm::none_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+inline bool none_of(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p);
+#else // DOXYGEN_WORKING
+template <class Function, class Iterator, class UnaryPredicate>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::transform_iterator<Function, Iterator>>))
+        ((__detail::__UnaryPredicateProxy<UnaryPredicate, stl_iterator::transform_iterator<Function, Iterator>>)),
+        // Return
+        (bool)
+    )
+inline none_of(
+    stl_iterator::transform_iterator<Function, Iterator> first,
+    stl_iterator::transform_iterator<Function, Iterator> last,
+    UnaryPredicate p)
+{
+    return stl_iterator::__detail::__fused_find_if(first, last, p) == last;
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_TRANSFORM_ITERATOR_HPP__
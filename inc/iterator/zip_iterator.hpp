@@ -0,0 +1,660 @@
+/** @file */
+#ifndef __STL_ITERATOR_ZIP_ITERATOR_HPP__
+#define __STL_ITERATOR_ZIP_ITERATOR_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <boost/concept/requires.hpp>
+#include "concept/input_iterator.hpp"
+#include "concept/move_constructible.hpp"
+#include "algorithm/detail/unary_function_proxy.hpp"
+#include "algorithm/detail/unary_predicate_proxy.hpp"
+#include "iterator/detail/index_sequence.hpp"
+#include "iterator/detail/iterator_traits.hpp"
+
+namespace stl_iterator {
+
+/**
+ * @brief Iterator adapter that traverses N ranges in lockstep, typically the columns of struct-of-arrays data.
+ *
+ * <p>
+ * Dereferencing yields a proxy reference, a std::tuple of the references of the underlying iterators, so that a
+ * predicate only reads the columns it actually accesses.<br/>
+ * The value type is the std::tuple of the underlying value types, to which the proxy reference is convertible.<br/>
+ * The iterator category is the weakest category of the underlying iterators.<br/>
+ * The first iterator defines the length of the zipped range: all other ranges must be at least as long.
+ * </p>
+ * @tparam Iterators - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ */
+template <class... Iterators>
+class zip_iterator
+{
+    static_assert(sizeof...(Iterators) > 0, "zip_iterator requires at least one iterator");
+
+public:
+    using iterator_category = typename std::common_type<__detail::__iterator_category_t<Iterators>...>::type;
+    using value_type = std::tuple<__detail::__iterator_value_t<Iterators>...>;
+    using reference = std::tuple<__detail::__iterator_reference_t<Iterators>...>;
+    using pointer = void;
+    using difference_type = typename std::common_type<__detail::__iterator_difference_t<Iterators>...>::type;
+    using iterator_tuple = std::tuple<Iterators...>;
+
+    zip_iterator() = default;
+
+    explicit zip_iterator(Iterators... iters)
+        : iters_(iters...)
+    {}
+
+    explicit zip_iterator(const iterator_tuple& iters)
+        : iters_(iters)
+    {}
+
+    /** @brief Returns the underlying iterators. */
+    const iterator_tuple& base() const
+    {
+        return iters_;
+    }
+
+    reference operator*() const
+    {
+        return dereference(__Indices());
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    zip_iterator& operator++()
+    {
+        increment(__Indices());
+        return *this;
+    }
+
+    zip_iterator operator++(int)
+    {
+        zip_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    zip_iterator& operator--()
+    {
+        decrement(__Indices());
+        return *this;
+    }
+
+    zip_iterator operator--(int)
+    {
+        zip_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    zip_iterator& operator+=(difference_type n)
+    {
+        advance(n, __Indices());
+        return *this;
+    }
+
+    zip_iterator& operator-=(difference_type n)
+    {
+        advance(-n, __Indices());
+        return *this;
+    }
+
+    friend zip_iterator operator+(zip_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend zip_iterator operator+(difference_type n, zip_iterator it)
+    {
+        return it += n;
+    }
+
+    friend zip_iterator operator-(zip_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return static_cast<difference_type>(std::get<0>(lhs.iters_) - std::get<0>(rhs.iters_));
+    }
+
+    friend bool operator==(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return std::get<0>(lhs.iters_) == std::get<0>(rhs.iters_);
+    }
+
+    friend bool operator!=(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return std::get<0>(lhs.iters_) < std::get<0>(rhs.iters_);
+    }
+
+    friend bool operator>(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const zip_iterator& lhs, const zip_iterator& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    using __Indices = __detail::__index_sequence_for<Iterators...>;
+    using __Swallow = int[];
+
+    template <std::size_t... I>
+    reference dereference(__detail::__index_sequence<I...>) const
+    {
+        return reference(*std::get<I>(iters_)...);
+    }
+
+    template <std::size_t... I>
+    void increment(__detail::__index_sequence<I...>)
+    {
+        (void)__Swallow{0, ((void)++std::get<I>(iters_), 0)...};
+    }
+
+    template <std::size_t... I>
+    void decrement(__detail::__index_sequence<I...>)
+    {
+        (void)__Swallow{0, ((void)--std::get<I>(iters_), 0)...};
+    }
+
+    template <std::size_t... I>
+    void advance(difference_type n, __detail::__index_sequence<I...>)
+    {
+        (void)__Swallow{0, ((void)(std::get<I>(iters_) +=
+            static_cast<__detail::__iterator_difference_t<typename std::tuple_element<I, iterator_tuple>::type>>(n)),
+            0)...};
+    }
+
+    iterator_tuple iters_;
+};
+
+/**
+ * @brief Creates a zip_iterator from the given iterators.
+ * @tparam Iterators - must meet the requirements of <i>stl_concept::InputIterator</i>.
+ * @param iters - iterators to be traversed in lockstep
+ * @return zip_iterator<Iterators...>(iters...)
+ */
+template <class... Iterators>
+inline zip_iterator<Iterators...> make_zip_iterator(Iterators... iters)
+{
+    return zip_iterator<Iterators...>(iters...);
+}
+
+/**
+ * @brief Function object adapter which passes only the selected columns of a zipped row to the wrapped function.
+ *
+ * <p>
+ * Given a row r, calls f(std::get<Columns>(r)...).<br/>
+ * The algorithms in <i>stl_algorithm</i> detect it on zip_iterator ranges and traverse only the selected columns.
+ * </p>
+ * @tparam Function - function object to be applied on the selected columns
+ * @tparam Columns - indices of the selected columns
+ */
+template <class Function, std::size_t... Columns>
+class column_function
+{
+public:
+    explicit column_function(Function f)
+        : f_(std::move(f))
+    {}
+
+    template <class Row>
+    auto operator()(Row&& row)
+        -> decltype(std::declval<Function&>()(std::get<Columns>(std::forward<Row>(row))...))
+    {
+        return f_(std::get<Columns>(std::forward<Row>(row))...);
+    }
+
+    template <class Row>
+    auto operator()(Row&& row) const
+        -> decltype(std::declval<const Function&>()(std::get<Columns>(std::forward<Row>(row))...))
+    {
+        return f_(std::get<Columns>(std::forward<Row>(row))...);
+    }
+
+    /** @brief Returns the wrapped function object. */
+    const Function& function() const
+    {
+        return f_;
+    }
+
+private:
+    Function f_;
+};
+
+/**
+ * @brief Creates a column_function which applies f on the selected columns.
+ * @tparam Columns - indices of the selected columns
+ * @param f - function object to be applied
+ * @return column_function<Function, Columns...>(f)
+ */
+template <std::size_t... Columns, class Function>
+inline column_function<Function, Columns...> columns(Function f)
+{
+    return column_function<Function, Columns...>(std::move(f));
+}
+
+namespace __detail {
+
+/// @cond DEV
+/**
+ * @brief Selects the given columns of a zip_iterator.
+ *
+ * A single column is returned as its underlying iterator, so that the scan runs on a plain iterator.
+ */
+template <std::size_t Column, class... Iterators>
+inline typename std::tuple_element<Column, std::tuple<Iterators...>>::type
+__select_columns(const zip_iterator<Iterators...>& it)
+{
+    return std::get<Column>(it.base());
+}
+
+template <std::size_t Column1, std::size_t Column2, std::size_t... Columns, class... Iterators>
+inline zip_iterator<
+    typename std::tuple_element<Column1, std::tuple<Iterators...>>::type,
+    typename std::tuple_element<Column2, std::tuple<Iterators...>>::type,
+    typename std::tuple_element<Columns, std::tuple<Iterators...>>::type...>
+__select_columns(const zip_iterator<Iterators...>& it)
+{
+    return make_zip_iterator(
+        std::get<Column1>(it.base()),
+        std::get<Column2>(it.base()),
+        std::get<Columns>(it.base())...);
+}
+
+/** @brief Rebinds a column_function to the columns returned by __select_columns. */
+template <class Function, std::size_t Column>
+inline Function __rebind_columns(const column_function<Function, Column>& f)
+{
+    return f.function();
+}
+
+template <class Function, std::size_t Column1, std::size_t Column2, std::size_t... Columns, std::size_t... I>
+inline column_function<Function, I...> __rebind_columns_impl(
+    const column_function<Function, Column1, Column2, Columns...>& f,
+    __index_sequence<I...>)
+{
+    return column_function<Function, I...>(f.function());
+}
+
+template <class Function, std::size_t Column1, std::size_t Column2, std::size_t... Columns>
+inline auto __rebind_columns(const column_function<Function, Column1, Column2, Columns...>& f)
+    -> decltype(__rebind_columns_impl(f, __make_index_sequence<sizeof...(Columns) + 2>()))
+{
+    return __rebind_columns_impl(f, __make_index_sequence<sizeof...(Columns) + 2>());
+}
+
+/** @brief Restores the column_function from the result of __rebind_columns. */
+template <class Function, std::size_t... Columns>
+inline column_function<Function, Columns...> __restore_columns(
+    const Function& f,
+    const column_function<Function, Columns...>&)
+{
+    return column_function<Function, Columns...>(f);
+}
+
+template <class Function, std::size_t... I, std::size_t... Columns>
+inline column_function<Function, Columns...> __restore_columns(
+    const column_function<Function, I...>& f,
+    const column_function<Function, Columns...>&)
+{
+    return column_function<Function, Columns...>(f.function());
+}
+
+template <class... Iterators>
+using __is_random_access_zip = __has_iterator_category<zip_iterator<Iterators...>, std::random_access_iterator_tag>;
+/// @endcond
+
+} // namespace __detail
+} // namespace stl_iterator
+
+namespace stl_algorithm {
+
+/// @cond DEV
+namespace __detail {
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::zip_iterator<Iterators...> __zip_find_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& p,
+    std::true_type)
+{
+    auto sub = stl_iterator::__detail::__select_columns<Columns...>(first);
+    auto found = std::find_if(sub, std::next(sub, last - first), stl_iterator::__detail::__rebind_columns(p));
+    return first + std::distance(sub, found);
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::zip_iterator<Iterators...> __zip_find_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& p,
+    std::false_type)
+{
+    return std::find_if(first, last, p);
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::zip_iterator<Iterators...> __zip_find_if_not(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& p,
+    std::true_type)
+{
+    auto sub = stl_iterator::__detail::__select_columns<Columns...>(first);
+    auto found = std::find_if_not(sub, std::next(sub, last - first), stl_iterator::__detail::__rebind_columns(p));
+    return first + std::distance(sub, found);
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::zip_iterator<Iterators...> __zip_find_if_not(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& p,
+    std::false_type)
+{
+    return std::find_if_not(first, last, p);
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline __iterator_difference_t<stl_iterator::zip_iterator<Iterators...>> __zip_count_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& p,
+    std::true_type)
+{
+    auto sub = stl_iterator::__detail::__select_columns<Columns...>(first);
+    return static_cast<__iterator_difference_t<stl_iterator::zip_iterator<Iterators...>>>(
+        std::count_if(sub, std::next(sub, last - first), stl_iterator::__detail::__rebind_columns(p)));
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline __iterator_difference_t<stl_iterator::zip_iterator<Iterators...>> __zip_count_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& p,
+    std::false_type)
+{
+    return std::count_if(first, last, p);
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::column_function<Function, Columns...> __zip_for_each(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& f,
+    std::true_type)
+{
+    auto sub = stl_iterator::__detail::__select_columns<Columns...>(first);
+    return stl_iterator::__detail::__restore_columns(
+        std::for_each(sub, std::next(sub, last - first), stl_iterator::__detail::__rebind_columns(f)),
+        f);
+}
+
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::column_function<Function, Columns...> __zip_for_each(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    const stl_iterator::column_function<Function, Columns...>& f,
+    std::false_type)
+{
+    return std::for_each(first, last, f);
+}
+
+} // namespace __detail
+/// @endcond
+
+/**
+ * @brief Overload of stl_algorithm::find_if for zip_iterator ranges with a column_function predicate.
+ *
+ * <p>
+ * On random access ranges only the columns selected by p are traversed.
+ * </p>
+ * @see stl_algorithm::find_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::zip_iterator<Iterators...> find_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((__detail::__UnaryPredicateProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (stl_iterator::zip_iterator<Iterators...>)
+    )
+inline find_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+{
+    return __detail::__zip_find_if(first, last, p, stl_iterator::__detail::__is_random_access_zip<Iterators...>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::find_if_not for zip_iterator ranges with a column_function predicate.
+ *
+ * <p>
+ * On random access ranges only the columns selected by p are traversed.
+ * </p>
+ * @see stl_algorithm::find_if_not
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::zip_iterator<Iterators...> find_if_not(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((__detail::__UnaryPredicateProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (stl_iterator::zip_iterator<Iterators...>)
+    )
+inline find_if_not(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+{
+    return __detail::__zip_find_if_not(first, last, p, stl_iterator::__detail::__is_random_access_zip<Iterators...>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::count_if for zip_iterator ranges with a column_function predicate.
+ *
+ * <p>
+ * On random access ranges only the columns selected by p are traversed.
+ * </p>
+ * @see stl_algorithm::count_if
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline auto count_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+    -> decltype(typename std::iterator_traits<stl_iterator::zip_iterator<Iterators...>>::difference_type);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((__detail::__UnaryPredicateProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (__detail::__iterator_difference_t<stl_iterator::zip_iterator<Iterators...>>)
+    )
+inline count_if(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+{
+    return __detail::__zip_count_if(first, last, p, stl_iterator::__detail::__is_random_access_zip<Iterators...>());
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::all_of for zip_iterator ranges with a column_function predicate.
+ * @see stl_algorithm::all_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline bool all_of(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((__detail::__UnaryPredicateProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (bool)
+    )
+inline all_of(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+{
+    return stl_algorithm::find_if_not(first, last, p) == last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::any_of for zip_iterator ranges with a column_function predicate.
+ * @see stl_algorithm::any_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline bool any_of(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((__detail::__UnaryPredicateProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (bool)
+    )
+inline any_of(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+{
+    return stl_algorithm::find_if(first, last, p) != last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::none_of for zip_iterator ranges with a column_function predicate.
+ * @see stl_algorithm::none_of
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline bool none_of(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((__detail::__UnaryPredicateProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (bool)
+    )
+inline none_of(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> p)
+{
+    return stl_algorithm::find_if(first, last, p) == last;
+}
+#endif // DOXYGEN_WORKING
+
+/**
+ * @brief Overload of stl_algorithm::for_each for zip_iterator ranges with a column_function.
+ *
+ * <p>
+ * On random access ranges only the columns selected by f are traversed.
+ * </p>
+ * @see stl_algorithm::for_each
+ */
+#ifdef DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+inline stl_iterator::column_function<Function, Columns...> for_each(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> f);
+#else // DOXYGEN_WORKING
+template <class... Iterators, class Function, std::size_t... Columns>
+    BOOST_CONCEPT_REQUIRES(
+        // Requirements
+        ((stl_concept::InputIterator<stl_iterator::zip_iterator<Iterators...>>))
+        ((stl_concept::MoveConstructible<stl_iterator::column_function<Function, Columns...>>))
+        ((__detail::__UnaryFunctionProxy<
+            stl_iterator::column_function<Function, Columns...>,
+            stl_iterator::zip_iterator<Iterators...>>)),
+        // Return
+        (stl_iterator::column_function<Function, Columns...>)
+    )
+inline for_each(
+    stl_iterator::zip_iterator<Iterators...> first,
+    stl_iterator::zip_iterator<Iterators...> last,
+    stl_iterator::column_function<Function, Columns...> f)
+{
+    return __detail::__zip_for_each(first, last, f, stl_iterator::__detail::__is_random_access_zip<Iterators...>());
+}
+#endif // DOXYGEN_WORKING
+
+} // namespace stl_algorithm
+
+#endif  // __STL_ITERATOR_ZIP_ITERATOR_HPP__
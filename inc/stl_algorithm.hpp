@@ -13,14 +13,22 @@
 #include "algorithm/any_of.hpp"
 #include "algorithm/none_of.hpp"
 #include "algorithm/for_each.hpp"
+#include "algorithm/for_each_budgeted.hpp"
 #include "algorithm/count.hpp"
 #include "algorithm/count_if.hpp"
+#include "algorithm/count_sorted.hpp"
 #include "algorithm/mismatch.hpp"
 #include "algorithm/mismatch_if.hpp"
 #include "algorithm/equal.hpp"
 #include "algorithm/equal_if.hpp"
+#include "algorithm/estimate_count_if.hpp"
 #include "algorithm/find.hpp"
 #include "algorithm/find_if.hpp"
 #include "algorithm/find_if_not.hpp"
+#include "algorithm/find_interpolated.hpp"
+#include "algorithm/find_sorted.hpp"
+#include "algorithm/fused_query.hpp"
+#include "algorithm/lower_bound_interpolated.hpp"
+#include "algorithm/resumable_find.hpp"
 
 #endif  // __STL_ALGORITHM_HPP__
@@ -36,6 +36,7 @@
 #include "concept/equality_comparable.hpp"
 #include "concept/equality_comparable_with.hpp"
 #include "concept/less_than_comparable.hpp"
+#include "concept/hashable.hpp"
 #include "concept/value_swappable.hpp"
 #include "concept/nullable_pointer.hpp"
 #include "concept/function_object.hpp"
@@ -0,0 +1,22 @@
+/**
+ * @file
+ * @brief Classes in this file define containers and structures which keep an index of their elements up to date, so
+ * that the wrappers of the C++ standard algorithms can answer repeated queries without scanning.
+ * @author Qu Xing
+ * @version 0.1
+ * @date 2018
+ * @copyright MIT License
+ */
+#ifndef __STL_INDEX_HPP__
+#define __STL_INDEX_HPP__
+
+#include "index/counted_vector.hpp"
+#include "index/eytzinger_index.hpp"
+#include "index/hash_index.hpp"
+#include "index/range_count_index.hpp"
+#include "index/result_cache.hpp"
+#include "index/succinct_bit_vector.hpp"
+#include "index/wavelet_matrix.hpp"
+#include "index/zoned_vector.hpp"
+
+#endif  // __STL_INDEX_HPP__
@@ -0,0 +1,28 @@
+/**
+ * @file
+ * @brief Classes in this file define iterator adapters which satisfy the iterator requirements and are recognized by
+ * the wrappers of the C++ standard algorithms.
+ * @author Qu Xing
+ * @version 0.1
+ * @date 2018
+ * @copyright MIT License
+ */
+#ifndef __STL_ITERATOR_HPP__
+#define __STL_ITERATOR_HPP__
+
+#include "iterator/bit_iterator.hpp"
+#include "iterator/chunked_input_iterator.hpp"
+#include "iterator/dictionary_range.hpp"
+#include "iterator/file_scanner.hpp"
+#include "iterator/filter_iterator.hpp"
+#include "iterator/gather_iterator.hpp"
+#include "iterator/generator.hpp"
+#include "iterator/iterator_range.hpp"
+#include "iterator/mapped_file.hpp"
+#include "iterator/packed_range.hpp"
+#include "iterator/rle_range.hpp"
+#include "iterator/strided_iterator.hpp"
+#include "iterator/transform_iterator.hpp"
+#include "iterator/zip_iterator.hpp"
+
+#endif  // __STL_ITERATOR_HPP__
@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <cassert>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <vector>
+#include "algorithm/count_sorted.hpp"
+
+namespace stl_algorithm {
+namespace test {
+
+void count_sorted_check()
+{
+    std::vector<int> v{0, 2, 2, 2, 3, 5, 8, 8, 13, 21, 28};
+    std::list<int> l(v.begin(), v.end());
+    std::forward_list<int> f(v.begin(), v.end());
+
+    for (int value = -1; value < 30; ++value) {
+        const auto number = std::count(v.begin(), v.end(), value);
+        assert(stl_algorithm::count_sorted(v.begin(), v.end(), value) == number);
+        assert(stl_algorithm::count_sorted(l.begin(), l.end(), value) == number);
+        assert(stl_algorithm::count_sorted(f.begin(), f.end(), value) == number);
+    }
+    assert(stl_algorithm::count_sorted(v.begin(), v.end(), 2l) == 3);
+    assert(stl_algorithm::count_sorted(f.begin(), f.begin(), 2) == 0);
+
+    std::vector<int> descending(v.rbegin(), v.rend());
+    std::forward_list<int> fdescending(descending.begin(), descending.end());
+    assert(stl_algorithm::count_sorted(descending.begin(), descending.end(), 8, std::greater<int>()) == 2);
+    assert(stl_algorithm::count_sorted(fdescending.begin(), fdescending.end(), 8, std::greater<int>()) == 2);
+
+    // A long run of equivalent elements.
+    std::forward_list<int> runs(1000, 7);
+    runs.push_front(1);
+    assert(stl_algorithm::count_sorted(runs.begin(), runs.end(), 7) == 1000);
+    assert(stl_algorithm::count_sorted(runs.begin(), runs.end(), 1) == 1);
+}
+
+} // namespace test
+} // namespace stl_algorithm
@@ -0,0 +1,83 @@
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "algorithm/estimate_count_if.hpp"
+
+namespace stl_algorithm {
+namespace test {
+
+namespace {
+
+bool contains(const stl_algorithm::count_estimate& estimate, double count)
+{
+    return estimate.lower <= count && count <= estimate.upper;
+}
+
+} // namespace
+
+void estimate_count_if_check()
+{
+    std::vector<int> v(1000000);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<int>(i);
+    }
+    auto multiple_of_10 = [](int i) { return i % 10 == 0; };
+    auto clustered = [](int i) { return i < 300000; };
+
+    auto estimate = stl_algorithm::estimate_count_if(v.begin(), v.end(), multiple_of_10, 0.99);
+    assert(!estimate.exact);
+    assert(estimate.samples == 4096);
+    // The internal generator is seeded on each call, so the count is only checked within 6 standard deviations.
+    assert(estimate.count > 72000.0 && estimate.count < 128000.0);
+    assert(estimate.lower <= estimate.count && estimate.count <= estimate.upper);
+    assert(estimate.upper - estimate.lower < 60000.0);
+
+    // The strata which are entirely in or out of the cluster are estimated exactly.
+    std::mt19937 g(7);
+    estimate = stl_algorithm::estimate_count_if(v.begin(), v.end(), clustered, 0.95, 640u, g);
+    assert(estimate.samples == 640);
+    assert(contains(estimate, 300000.0));
+    assert(estimate.count > 290000.0 && estimate.count < 310000.0);
+
+    auto narrower = stl_algorithm::estimate_count_if(v.begin(), v.end(), multiple_of_10, 0.99, 100000u, g);
+    assert(contains(narrower, 100000.0));
+    assert(narrower.upper - narrower.lower < estimate.upper - estimate.lower);
+    auto wider = stl_algorithm::estimate_count_if(v.begin(), v.end(), multiple_of_10, 0.999, 100000u, g);
+    assert(wider.upper - wider.lower > narrower.upper - narrower.lower);
+
+    // Ranges no larger than the samples are examined entirely.
+    std::vector<int> small(v.begin(), v.begin() + 1000);
+    estimate = stl_algorithm::estimate_count_if(small.begin(), small.end(), multiple_of_10, 0.95);
+    assert(estimate.exact && estimate.samples == 1000);
+    assert(estimate.count == 100.0 && estimate.lower == 100.0 && estimate.upper == 100.0);
+
+    std::vector<int> empty;
+    estimate = stl_algorithm::estimate_count_if(empty.begin(), empty.end(), multiple_of_10, 0.95);
+    assert(estimate.exact && estimate.count == 0.0 && estimate.samples == 0);
+
+    // An expired deadline still draws one round of 32 samples per stratum.
+    const auto past = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    estimate = stl_algorithm::estimate_count_if(v.begin(), v.end(), multiple_of_10, 0.95, past, g);
+    assert(!estimate.exact && estimate.samples == 1024);
+    assert(contains(estimate, 100000.0));
+
+    estimate = stl_algorithm::estimate_count_if(small.begin(), small.end(), clustered, 0.95, std::chrono::hours(1));
+    assert(estimate.exact && estimate.count == 1000.0);
+    std::vector<int> medium(v.begin(), v.begin() + 50000);
+    estimate = stl_algorithm::estimate_count_if(
+        medium.begin(), medium.end(), multiple_of_10, 0.95, std::chrono::hours(1));
+    assert(estimate.exact && estimate.count == 5000.0);
+
+    bool thrown = false;
+    try {
+        stl_algorithm::estimate_count_if(v.begin(), v.end(), multiple_of_10, 1.0);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+} // namespace test
+} // namespace stl_algorithm
@@ -0,0 +1,39 @@
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include "algorithm/find_interpolated.hpp"
+
+namespace stl_algorithm {
+namespace test {
+
+void find_interpolated_check()
+{
+    std::vector<std::int64_t> v;
+    for (std::int64_t i = -500; i < 500; ++i) {
+        v.push_back(3 * i);
+        if (i % 10 == 0) {
+            v.push_back(3 * i);
+        }
+    }
+    stl_algorithm::interpolation_statistics stats;
+    for (std::int64_t value = -1600; value < 1600; ++value) {
+        auto found = stl_algorithm::find_interpolated(v.begin(), v.end(), value, stats);
+        if (value % 3 == 0 && value >= -1500 && value < 1500) {
+            assert(found != v.end() && *found == value);
+            assert(found == v.begin() || *(found - 1) < value);
+        } else {
+            assert(found == v.end());
+        }
+    }
+    assert(stats.searches == 3200);
+    assert(stats.fallbacks == 0);
+
+    std::vector<unsigned> ids{2, 3, 5, 7, 11, 13};
+    assert(stl_algorithm::find_interpolated(ids.begin(), ids.end(), 7u) == ids.begin() + 3);
+    assert(stl_algorithm::find_interpolated(ids.begin(), ids.end(), 8u) == ids.end());
+    assert(stl_algorithm::find_interpolated(ids.begin(), ids.end(), 20u) == ids.end());
+    assert(stl_algorithm::find_interpolated(ids.begin(), ids.begin(), 2u) == ids.begin());
+}
+
+} // namespace test
+} // namespace stl_algorithm
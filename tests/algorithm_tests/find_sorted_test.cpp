@@ -0,0 +1,75 @@
+#include <cassert>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+#include "algorithm/find_sorted.hpp"
+
+namespace stl_algorithm {
+namespace test {
+
+namespace {
+
+struct Record
+{
+    int id;
+    std::string name;
+};
+
+struct IdLess
+{
+    bool operator()(const Record& lhs, int rhs) const
+    {
+        return lhs.id < rhs;
+    }
+
+    bool operator()(int lhs, const Record& rhs) const
+    {
+        return lhs < rhs.id;
+    }
+};
+
+template <class Container>
+void check_sorted_ids(const Container& c)
+{
+    for (int value = -1; value < 30; ++value) {
+        auto found = stl_algorithm::find_sorted(c.begin(), c.end(), value);
+        auto expected = c.begin();
+        while (expected != c.end() && *expected != value) {
+            ++expected;
+        }
+        assert(found == expected);
+    }
+    assert(stl_algorithm::find_sorted(c.begin(), c.begin(), 0) == c.begin());
+}
+
+} // namespace
+
+void find_sorted_check()
+{
+    std::vector<int> v{0, 2, 2, 2, 3, 5, 8, 8, 13, 21, 28};
+    check_sorted_ids(v);
+    check_sorted_ids(std::list<int>(v.begin(), v.end()));
+    check_sorted_ids(std::forward_list<int>(v.begin(), v.end()));
+
+    assert(stl_algorithm::find_sorted(v.begin(), v.end(), 2l) == v.begin() + 1);
+    assert(stl_algorithm::find_sorted(v.begin(), v.end(), 2.5) == v.end());
+
+    std::vector<int> descending(v.rbegin(), v.rend());
+    assert(stl_algorithm::find_sorted(descending.begin(), descending.end(), 8, std::greater<int>()) ==
+        descending.begin() + 3);
+
+    std::forward_list<Record> records{{1, "a"}, {4, "b"}, {4, "c"}, {9, "d"}};
+    auto found = stl_algorithm::find_sorted(records.begin(), records.end(), 4, IdLess());
+    assert(found != records.end() && found->name == "b");
+    assert(stl_algorithm::find_sorted(records.begin(), records.end(), 5, IdLess()) == records.end());
+    assert(stl_algorithm::find_sorted(records.begin(), records.end(), 10, IdLess()) == records.end());
+
+    std::vector<std::string> names{"ant", "bee", "cat"};
+    assert(stl_algorithm::find_sorted(names.begin(), names.end(), "bee") == names.begin() + 1);
+}
+
+} // namespace test
+} // namespace stl_algorithm
@@ -0,0 +1,77 @@
+
+#include <cassert>
+#include <chrono>
+#include <list>
+#include <numeric>
+#include <vector>
+#include "algorithm/for_each_budgeted.hpp"
+
+namespace stl_algorithm {
+namespace test {
+namespace {
+
+struct Sum
+{
+    long long sum;
+    int calls;
+
+    void operator()(int i)
+    {
+        sum += i;
+        ++calls;
+    }
+};
+
+} // namespace
+
+void for_each_budgeted_check()
+{
+    std::vector<int> v(10000);
+    std::iota(v.begin(), v.end(), 1);
+    std::list<int> l(v.begin(), v.end());
+
+    {
+        auto result = stl_algorithm::for_each_budgeted(v.begin(), v.end(), Sum{0, 0}, 100u);
+        assert(result.in == v.begin() + 100);
+        assert(result.fun.sum == 5050);
+        result = stl_algorithm::for_each_budgeted(result.in, v.end(), result.fun, 1000000u);
+        assert(result.in == v.end());
+        assert(result.fun.sum == 50005000 && result.fun.calls == 10000);
+    }
+    {
+        auto result = stl_algorithm::for_each_budgeted(l.begin(), l.end(), Sum{0, 0}, 3u);
+        assert(*result.in == 4);
+        assert(result.fun.sum == 6);
+    }
+    {
+        // An expired deadline still processes one block of 1024 elements.
+        const auto past = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+        auto result = stl_algorithm::for_each_budgeted(v.begin(), v.end(), Sum{0, 0}, past);
+        assert(result.in == v.begin() + 1024);
+        assert(result.fun.calls == 1024);
+
+        auto lresult = stl_algorithm::for_each_budgeted(l.begin(), l.end(), Sum{0, 0}, past);
+        assert(*lresult.in == 1025);
+    }
+    {
+        Sum sum{0, 0};
+        auto first = v.begin();
+        int slices = 0;
+        while (first != v.end()) {
+            auto result = stl_algorithm::for_each_budgeted(first, v.end(), sum, std::chrono::hours(1));
+            first = result.in;
+            sum = result.fun;
+            ++slices;
+        }
+        assert(slices == 1);
+        assert(sum.sum == 50005000);
+    }
+    {
+        std::vector<int> empty;
+        auto result = stl_algorithm::for_each_budgeted(empty.begin(), empty.end(), Sum{0, 0}, std::chrono::seconds(0));
+        assert(result.in == empty.end() && result.fun.calls == 0);
+    }
+}
+
+} // namespace test
+} // namespace stl_algorithm
@@ -0,0 +1,83 @@
+
+#include <cassert>
+#include <sstream>
+#include <iterator>
+#include <list>
+#include <tuple>
+#include <vector>
+#include "algorithm/fused_query.hpp"
+
+namespace stl_algorithm {
+namespace test {
+namespace {
+
+bool is_even(int i)
+{
+    return i % 2 == 0;
+}
+
+struct CountingPositive
+{
+    bool operator()(int i)
+    {
+        ++*calls;
+        return i > 0;
+    }
+
+    int* calls;
+};
+
+} // namespace
+
+void fused_query_check()
+{
+    std::vector<int> v{3, 1, 4, 1, 5, 9, 2, 6};
+    auto first = v.begin();
+    auto last = v.end();
+
+    auto results = stl_algorithm::fused_query(first, last, std::make_tuple(
+        query::count_if(is_even),
+        query::find_if([](int i) { return i > 4; }),
+        query::all_of([](int i) { return i > 0; }),
+        query::any_of([](int i) { return i == 9; }),
+        query::none_of([](int i) { return i > 9; }),
+        query::count(1),
+        query::find(7l)));
+    assert(std::get<0>(results) == 3);
+    assert(std::get<1>(results) == first + 4);
+    assert(std::get<2>(results));
+    assert(std::get<3>(results));
+    assert(std::get<4>(results));
+    assert(std::get<5>(results) == 2);
+    assert(std::get<6>(results) == last);
+
+    // a decided query is not evaluated any more, and the traversal stops once all queries are decided
+    int calls = 0;
+    auto decided = stl_algorithm::fused_query(first, last, std::make_tuple(
+        query::any_of(CountingPositive{&calls}),
+        query::find(4)));
+    assert(std::get<0>(decided));
+    assert(std::get<1>(decided) == first + 2);
+    assert(calls == 1);
+
+    std::list<int> l{2, 4, 6, 7};
+    auto lresults = stl_algorithm::fused_query(l.begin(), l.end(), std::make_tuple(
+        query::all_of(is_even),
+        query::find_if([](int i) { return i > 5; })));
+    assert(!std::get<0>(lresults));
+    assert(*std::get<1>(lresults) == 6);
+
+    // single pass input iterators support the queries which do not return an iterator
+    std::istringstream is("1 2 3 4 5");
+    auto iresults = stl_algorithm::fused_query(std::istream_iterator<int>(is), std::istream_iterator<int>(),
+        std::make_tuple(query::count_if(is_even), query::none_of([](int i) { return i > 5; })));
+    assert(std::get<0>(iresults) == 2);
+    assert(std::get<1>(iresults));
+
+    auto empty = stl_algorithm::fused_query(last, last, std::make_tuple(query::all_of(is_even), query::count(0)));
+    assert(std::get<0>(empty));
+    assert(std::get<1>(empty) == 0);
+}
+
+} // namespace test
+} // namespace stl_algorithm
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "algorithm/lower_bound_interpolated.hpp"
+
+namespace stl_algorithm {
+namespace test {
+
+namespace {
+
+template <class T>
+void check_lower_bounds(const std::vector<T>& v, const std::vector<T>& values)
+{
+    for (T value : values) {
+        assert(stl_algorithm::lower_bound_interpolated(v.begin(), v.end(), value) ==
+            std::lower_bound(v.begin(), v.end(), value));
+    }
+}
+
+} // namespace
+
+void lower_bound_interpolated_check()
+{
+    std::vector<std::uint64_t> ids;
+    for (std::uint64_t i = 0; i < 10000; ++i) {
+        ids.push_back(1000 + 7 * i);
+    }
+    stl_algorithm::interpolation_statistics uniform;
+    for (std::uint64_t value = 990; value < 71020; value += 3) {
+        auto found = stl_algorithm::lower_bound_interpolated(ids.begin(), ids.end(), value, uniform);
+        assert(found == std::lower_bound(ids.begin(), ids.end(), value));
+    }
+    assert(uniform.searches == 23344);
+    assert(uniform.fallbacks == 0);
+    assert(uniform.interpolation_probes > 0);
+    // Keys evenly spread take a few probes per search, bisection would take 14.
+    assert(uniform.interpolation_probes + uniform.binary_probes < 8 * uniform.searches);
+
+    std::vector<std::uint64_t> skewed;
+    for (unsigned i = 0; i < 64; ++i) {
+        for (unsigned j = 0; j < 100; ++j) {
+            skewed.push_back((std::uint64_t(1) << i) + j);
+        }
+    }
+    std::sort(skewed.begin(), skewed.end());
+    stl_algorithm::interpolation_statistics skew;
+    for (std::size_t i = 0; i < skewed.size(); i += 37) {
+        auto found = stl_algorithm::lower_bound_interpolated(skewed.begin(), skewed.end(), skewed[i], skew);
+        assert(found == std::lower_bound(skewed.begin(), skewed.end(), skewed[i]));
+    }
+    assert(skew.fallbacks > 0);
+    assert(skew.binary_probes > 0);
+
+    std::vector<int> signed_values{-1000, -1000, -300, -2, 0, 0, 0, 5, 17, 17, 40, 41, 42, 43, 44, 45, 46, 47, 48, 200,
+        std::numeric_limits<int>::max()};
+    std::vector<int> queries{std::numeric_limits<int>::min(), -1001, -1000, -999, -3, -2, -1, 0, 1, 17, 18, 47, 199,
+        200, 201, std::numeric_limits<int>::max()};
+    check_lower_bounds(signed_values, queries);
+
+    std::vector<short> duplicates(100, 3);
+    duplicates.insert(duplicates.end(), 100, 9);
+    check_lower_bounds(duplicates, std::vector<short>{0, 3, 4, 9, 10});
+
+    std::vector<unsigned char> bytes;
+    for (unsigned i = 0; i < 256; ++i) {
+        bytes.push_back(static_cast<unsigned char>(i));
+    }
+    check_lower_bounds(bytes, std::vector<unsigned char>{0, 1, 128, 254, 255});
+
+    std::vector<long> empty;
+    stl_algorithm::interpolation_statistics none;
+    assert(stl_algorithm::lower_bound_interpolated(empty.begin(), empty.end(), 1l, none) == empty.end());
+    assert(none.searches == 1 && none.interpolation_probes == 0 && none.binary_probes == 0);
+}
+
+} // namespace test
+} // namespace stl_algorithm
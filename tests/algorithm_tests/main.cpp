@@ -9,15 +9,23 @@ int main()
     any_of_check();
     none_of_check();
     for_each_check();
+    for_each_budgeted_check();
     count_check();
     count_if_check();
+    count_sorted_check();
     mismatch_check();
     mismatch_if_check();
     equal_check();
     equal_if_check();
+    estimate_count_if_check();
     find_check();
     find_if_check();
     find_if_not_check();
+    find_interpolated_check();
+    find_sorted_check();
+    fused_query_check();
+    lower_bound_interpolated_check();
+    resumable_find_check();
 
     return 0;
 }
@@ -0,0 +1,90 @@
+
+#include <cassert>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "algorithm/resumable_find.hpp"
+
+namespace stl_algorithm {
+namespace test {
+
+void resumable_find_check()
+{
+    {
+        std::vector<int> piece1{1, 2, 3};
+        std::vector<int> piece2{4, 5, 3, 6};
+        find_state state;
+
+        assert(stl_algorithm::find(piece1.begin(), piece1.end(), 5, state) == piece1.end());
+        assert(state.offset() == 3);
+        auto it = stl_algorithm::find(piece2.begin(), piece2.end(), 5, state);
+        assert(it == piece2.begin() + 1);
+        assert(state.match() == 4);
+        assert(state.offset() == 5);
+
+        it = stl_algorithm::find_if(std::next(it), piece2.end(), [](int i) { return i % 3 == 0; }, state);
+        assert(it == piece2.begin() + 2);
+        assert(state.match() == 5);
+    }
+    {
+        std::istringstream is1("ab");
+        std::istringstream is2("cd");
+        find_state state;
+        std::istreambuf_iterator<char> last;
+        assert(stl_algorithm::find(std::istreambuf_iterator<char>(is1), last, 'd', state) == last);
+        assert(state.offset() == 2);
+        assert(*stl_algorithm::find(std::istreambuf_iterator<char>(is2), last, 'd', state) == 'd');
+        assert(state.match() == 3);
+    }
+    {
+        // The pattern "abab" occurs at 2 and 4, split over the pieces.
+        const std::string pattern = "abab";
+        const std::string piece1 = "xxab";
+        const std::string piece2 = "abab";
+        auto state = make_search_state(pattern.begin(), pattern.end());
+
+        assert(stl_algorithm::search(piece1.begin(), piece1.end(), state) == piece1.end());
+        assert(state.partial() == 2);
+        auto it = stl_algorithm::search(piece2.begin(), piece2.end(), state);
+        assert(it == piece2.begin() + 2);
+        assert(state.match() == 2);
+        it = stl_algorithm::search(it, piece2.end(), state);
+        assert(it == piece2.end());
+        assert(state.match() == 4);
+        assert(state.offset() == 8);
+
+        std::list<char> piece3{'a', 'a', 'b'};
+        assert(stl_algorithm::search(piece3.begin(), piece3.end(), state) == piece3.end());
+        assert(state.partial() == 2);
+
+        search_state<char> empty(pattern.begin(), pattern.begin());
+        assert(stl_algorithm::search(piece1.begin(), piece1.end(), empty) == piece1.begin());
+    }
+    {
+        std::vector<int> a1{1, 2, 3, 4};
+        std::vector<int> b1{1, 2};
+        std::vector<int> b2{3, 4, 5, 0};
+        std::vector<int> a2{5, 6};
+        mismatch_state state;
+
+        auto found = stl_algorithm::mismatch(a1.begin(), a1.end(), b1.begin(), b1.end(), state);
+        assert(found.first == a1.begin() + 2 && found.second == b1.end());
+        assert(!state.mismatched() && state.offset() == 2);
+
+        found = stl_algorithm::mismatch(found.first, a1.end(), b2.begin(), b2.end(), state);
+        assert(found.first == a1.end() && found.second == b2.begin() + 2);
+        assert(!state.mismatched() && state.offset() == 4);
+
+        found = stl_algorithm::mismatch(a2.begin(), a2.end(), found.second, b2.end(), state);
+        assert(*found.first == 6 && *found.second == 0);
+        assert(state.mismatched() && state.offset() == 5);
+
+        found = stl_algorithm::mismatch(a2.begin(), a2.end(), b2.begin(), b2.end(), state);
+        assert(found.first == a2.begin() && state.offset() == 5);
+    }
+}
+
+} // namespace test
+} // namespace stl_algorithm
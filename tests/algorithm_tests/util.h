@@ -9,15 +9,23 @@ void all_of_check();
 void any_of_check();
 void none_of_check();
 void for_each_check();
+void for_each_budgeted_check();
 void count_check();
 void count_if_check();
+void count_sorted_check();
 void mismatch_check();
 void mismatch_if_check();
 void equal_check();
 void equal_if_check();
+void estimate_count_if_check();
 void find_check();
 void find_if_check();
 void find_if_not_check();
+void find_interpolated_check();
+void find_sorted_check();
+void fused_query_check();
+void lower_bound_interpolated_check();
+void resumable_find_check();
 
 } // namespace test
 } // namespace stl_algorithm
@@ -0,0 +1,73 @@
+
+#include <functional>
+#include <string>
+#include "util.h"
+#include "concept/compare.hpp"
+
+namespace stl_concept {
+namespace test {
+namespace {
+
+struct Record
+{
+    int id;
+};
+
+struct RecordLess
+{
+    bool operator()(const Record& lhs, const Record& rhs) const
+    {
+        return lhs.id < rhs.id;
+    }
+};
+
+struct RecordIdLess
+{
+    bool operator()(const Record& lhs, int rhs) const
+    {
+        return lhs.id < rhs;
+    }
+
+    bool operator()(int lhs, const Record& rhs) const
+    {
+        return lhs < rhs.id;
+    }
+};
+
+bool less_func(int lhs, int rhs)
+{
+    return lhs < rhs;
+}
+
+using CompareTL = mpl::vector<
+    std::less<int>,
+    std::greater<int>,
+    bool(*)(int, int),
+    std::function<bool(int, int)>
+>;
+
+struct ConceptChecker
+{
+    template <class T>
+    void operator()(T&)
+    {
+        BOOST_CONCEPT_ASSERT((stl_concept::Compare<T, int, int>));
+    }
+};
+
+} // namespace
+
+void compare_check()
+{
+    (void)(less_func(0, 0));
+
+    BOOST_CONCEPT_ASSERT((stl_concept::Compare<RecordLess, Record, Record>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Compare<RecordIdLess, Record, int>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Compare<RecordIdLess, int, Record>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Compare<std::less<std::string>, std::string, const char*>));
+
+    mpl::for_each<CompareTL>(ConceptChecker());
+}
+
+} // namespace test
+} // namespace stl_concept
@@ -0,0 +1,77 @@
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include "util.h"
+#include "concept/hashable.hpp"
+
+namespace stl_concept {
+namespace test {
+namespace {
+
+struct HashType
+{
+    friend bool operator==(const HashType&, const HashType&)
+    {
+        return true;
+    }
+
+    friend bool operator!=(const HashType&, const HashType&)
+    {
+        return false;
+    }
+};
+
+} // namespace
+} // namespace test
+} // namespace stl_concept
+
+namespace std {
+
+template <>
+struct hash<stl_concept::test::HashType>
+{
+    std::size_t operator()(const stl_concept::test::HashType&) const noexcept
+    {
+        return 0;
+    }
+};
+
+} // namespace std
+
+namespace stl_concept {
+namespace test {
+namespace {
+
+using HashableTL = mpl::vector<
+    mpl::identity<int>,
+    mpl::identity<const int>,
+    mpl::identity<char>,
+    mpl::identity<double>,
+    mpl::identity<std::string>,
+    mpl::identity<const std::string>,
+    mpl::identity<int*>,
+    mpl::identity<const HashType*>,
+    mpl::identity<HashType>,
+    mpl::identity<const HashType>
+>;
+
+struct ConceptChecker
+{
+    template <class T>
+    void operator()(T&)
+    {
+        using Type = typename T::type;
+        BOOST_CONCEPT_ASSERT((stl_concept::Hashable<Type>));
+    }
+};
+
+} // namespace
+
+void hashable_check()
+{
+    mpl::for_each<HashableTL>(ConceptChecker());
+}
+
+} // namespace test
+} // namespace stl_concept
@@ -28,6 +28,7 @@ using IteratorTL = mpl::vector<
     std::multiset<LessType>::iterator,
     std::unordered_set<DefaultType, HashFunctor<DefaultType>>::iterator,
     std::unordered_multiset<DefaultType, HashFunctor<DefaultType>>::iterator,
+    std::vector<bool>::iterator,
     std::vector<DefaultType>::iterator
 >;
 
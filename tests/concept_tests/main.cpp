@@ -25,6 +25,7 @@ int main()
     // library-wide group
     equality_comparable_check();
     less_comparable_check();
+    hashable_check();
     value_swappable_check();
     nullable_pointer_check();
     function_object_check();
@@ -32,6 +33,7 @@ int main()
     unary_function_check();
     binary_predicate_check();
     binary_function_check();
+    compare_check();
 
     // iterator group
     iterator_check();
@@ -20,8 +20,8 @@ using PointerTL = mpl::vector<
     NullablePointerType,
     std::unique_ptr<DefaultType>::pointer,
     std::shared_ptr<DefaultType>,
-    std::allocator<DefaultType>::pointer,
-    std::allocator<DefaultType>::const_pointer,
+    std::allocator_traits<std::allocator<DefaultType>>::pointer,
+    std::allocator_traits<std::allocator<DefaultType>>::const_pointer,
     std::scoped_allocator_adaptor<std::allocator<DefaultType>>::pointer,
     std::scoped_allocator_adaptor<std::allocator<DefaultType>>::const_pointer,
     std::scoped_allocator_adaptor<std::allocator<DefaultType>>::void_pointer,
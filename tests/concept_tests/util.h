@@ -100,6 +100,7 @@ void copyable_check();
 // library-wide group
 void equality_comparable_check();
 void less_comparable_check();
+void hashable_check();
 void value_swappable_check();
 void nullable_pointer_check();
 void function_object_check();
@@ -107,6 +108,7 @@ void unary_predicate_check();
 void unary_function_check();
 void binary_predicate_check();
 void binary_function_check();
+void compare_check();
 
 // iterator group
 void iterator_check();
@@ -0,0 +1,75 @@
+
+#include <cassert>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/copy_insertable.hpp"
+#include "concept/erasable.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/count.hpp"
+#include "index/counted_vector.hpp"
+
+namespace stl_index {
+namespace test {
+
+void counted_vector_check()
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyInsertable<int, counted_vector<int>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::Erasable<int, counted_vector<int>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyInsertable<std::string, counted_vector<std::string>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<counted_vector<int>::const_iterator>));
+
+    {
+        counted_vector<int> v{1, 2, 2, 3, 3, 3};
+        assert(v.count(3) == 3);
+        assert(v.count(4) == 0);
+        assert(v.distinct() == 3);
+        assert(stl_algorithm::count(v.begin(), v.end(), 2) == 2);
+        assert(stl_algorithm::count(v.begin() + 2, v.end(), 2) == 1);
+        assert(stl_algorithm::count(v.begin(), v.end(), 3L) == 3);
+
+        v.push_back(2);
+        v.emplace_back(4);
+        assert(v.count(2) == 3 && v.count(4) == 1);
+        v.pop_back();
+        assert(v.count(4) == 0 && v.distinct() == 3);
+
+        v.insert(v.begin(), v[1]);
+        assert(v.front() == 2 && v.count(2) == 4);
+        std::list<int> more{5, 5, 1};
+        auto it = v.insert(v.begin() + 1, more.begin(), more.end());
+        assert(*it == 5 && v.count(5) == 2 && v.count(1) == 2);
+
+        it = v.erase(v.begin(), v.begin() + 3);
+        assert(*it == 1 && v.count(5) == 0 && v.count(2) == 3);
+
+        v.replace(v.begin(), 3);
+        assert(v.count(1) == 1 && v.count(3) == 4);
+        v.replace(v.begin(), 3);
+        assert(v.count(3) == 4);
+
+        std::vector<int> expected{3, 1, 2, 2, 3, 3, 3, 2};
+        assert(std::vector<int>(v.begin(), v.end()) == expected);
+        assert(v.base() == expected);
+    }
+    {
+        counted_vector<std::string> v(3, "a");
+        assert(v.count("a") == 3);
+        v.assign({"b", "c", "b"});
+        assert(v.count("a") == 0 && v.count("b") == 2);
+        assert(stl_algorithm::count(v.begin(), v.end(), std::string("c")) == 1);
+        v.clear();
+        assert(v.empty() && v.distinct() == 0);
+    }
+    {
+        counted_vector<int> a{1, 2};
+        counted_vector<int> b{3};
+        swap(a, b);
+        assert(a.count(3) == 1 && b.count(1) == 1);
+        assert(a != b);
+    }
+}
+
+} // namespace test
+} // namespace stl_index
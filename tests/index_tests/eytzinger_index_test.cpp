@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "index/eytzinger_index.hpp"
+
+namespace stl_index {
+namespace test {
+
+void eytzinger_index_check()
+{
+    std::mt19937 random(17);
+    for (std::size_t n = 0; n < 300; n += n < 20 ? 1 : 37) {
+        std::vector<int> values(n);
+        for (auto& v : values) {
+            v = static_cast<int>(random() % (n + 1)) * 2;
+        }
+        std::sort(values.begin(), values.end());
+        auto index = make_eytzinger_index(values.begin(), values.end());
+        assert(index.size() == n && index.begin() == values.begin() && index.end() == values.end());
+        for (int value = -1; value <= static_cast<int>(2 * n + 2); ++value) {
+            auto expected = std::lower_bound(values.begin(), values.end(), value);
+            assert(index.lower_bound(value) == expected);
+            assert(index.rank(value) == static_cast<std::size_t>(expected - values.begin()));
+            assert(index.find(value) == (expected != values.end() && *expected == value ? expected : values.end()));
+        }
+    }
+    {
+        const std::deque<std::string> names{"yak", "ox", "emu", "cat", "ant"};
+        auto index = make_eytzinger_index(names.begin(), names.end(), std::greater<std::string>());
+        assert(index.find("emu") == names.begin() + 2);
+        assert(index.find("dog") == names.end());
+        assert(index.lower_bound("dog") == names.begin() + 3);
+        assert(index.memory_usage() >= names.size() * sizeof(std::string));
+
+        const double ratios[] = {0.5, 1.5, 2.5};
+        auto doubles = make_eytzinger_index(ratios, ratios + 3);
+        assert(doubles.find(1.5) == ratios + 1);
+        assert(doubles.lower_bound(2) == ratios + 2);
+    }
+}
+
+} // namespace test
+} // namespace stl_index
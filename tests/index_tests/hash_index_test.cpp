@@ -0,0 +1,90 @@
+
+#include <algorithm>
+#include <cassert>
+#include <forward_list>
+#include <string>
+#include <vector>
+#include "algorithm/find.hpp"
+#include "index/hash_index.hpp"
+
+namespace stl_index {
+namespace test {
+
+void hash_index_check()
+{
+    {
+        std::vector<int> table(1000);
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            table[i] = static_cast<int>(i * 37 % 101);
+        }
+        generation table_generation;
+        auto index = make_hash_index(table.begin(), table.end(), table_generation);
+        assert(index.size() == 1000 && index.distinct() == 101);
+        for (int value = -5; value < 110; ++value) {
+            assert(stl_algorithm::find(table.begin(), table.end(), value, index) ==
+                std::find(table.begin(), table.end(), value));
+        }
+        assert(stl_algorithm::find(table.begin(), table.end(), 37L, index) == table.begin() + 1);
+
+        bool thrown = false;
+        try {
+            stl_algorithm::find(table.begin() + 1, table.end(), 1, index);
+        } catch (const stale_index&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        // Rebuilding the range in place without bumping its generation changes the hashes of the indexed elements.
+        for (int& value : table) {
+            value += 1000;
+        }
+        thrown = false;
+        try {
+            stl_algorithm::find(table.begin(), table.end(), 36, index);
+        } catch (const stale_index&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    {
+        std::forward_list<std::string> words{"b", "a", "c", "a"};
+        generation words_generation;
+        auto index = make_hash_index(words.begin(), words.end(), words_generation);
+        assert(index.distinct() == 3);
+        assert(stl_algorithm::find(words.begin(), words.end(), std::string("a"), index) == std::next(words.begin()));
+        assert(index.find(std::string("d")) == words.end());
+    }
+    {
+        // Hashed and compared as int, 1.5 would be found as 1.
+        std::vector<int> table{0, 1, 2, 3};
+        generation table_generation;
+        auto index = make_hash_index(table.begin(), table.end(), table_generation);
+        assert(stl_algorithm::find(table.begin(), table.end(), 1.5, index) == table.end());
+        assert(stl_algorithm::find(table.begin(), table.end(), 2.0, index) == table.begin() + 2);
+
+        // The storage is reused, so only the generation tells that 10 is now indexed by nothing.
+        table.assign({10, 11, 12, 13});
+        table_generation.bump();
+        assert(!index.current());
+        bool thrown = false;
+        try {
+            stl_algorithm::find(table.begin(), table.end(), 10, index);
+        } catch (const stale_index&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        index = make_hash_index(table.begin(), table.end(), table_generation);
+        assert(index.current());
+        assert(stl_algorithm::find(table.begin(), table.end(), 10, index) == table.begin());
+    }
+    {
+        std::vector<int> empty;
+        generation empty_generation;
+        auto index = make_hash_index(empty.begin(), empty.end(), empty_generation);
+        assert(stl_algorithm::find(empty.begin(), empty.end(), 1, index) == empty.end());
+    }
+}
+
+} // namespace test
+} // namespace stl_index
@@ -0,0 +1,18 @@
+
+#include "util.h"
+
+int main()
+{
+    using namespace stl_index::test;
+
+    counted_vector_check();
+    eytzinger_index_check();
+    hash_index_check();
+    range_count_index_check();
+    result_cache_check();
+    succinct_bit_vector_check();
+    wavelet_matrix_check();
+    zoned_vector_check();
+
+    return 0;
+}
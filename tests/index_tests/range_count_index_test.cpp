@@ -0,0 +1,64 @@
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+#include "index/range_count_index.hpp"
+
+namespace stl_index {
+namespace test {
+namespace {
+
+bool is_even(int i)
+{
+    return i % 2 == 0;
+}
+
+} // namespace
+
+void range_count_index_check()
+{
+    std::vector<int> v(1000);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<int>(i * 7 % 13);
+    }
+    auto index = make_range_count_index(v.begin(), v.end(), is_even);
+    assert(index.size() == 1000);
+    assert(index.count() == static_cast<std::size_t>(std::count_if(v.begin(), v.end(), is_even)));
+
+    const std::size_t bounds[][2] = {{0, 0}, {0, 1}, {3, 17}, {100, 999}, {511, 513}, {0, 1000}};
+    for (const auto& b : bounds) {
+        auto expected = std::count_if(v.begin() + static_cast<long>(b[0]), v.begin() + static_cast<long>(b[1]),
+            is_even);
+        assert(index.count(b[0], b[1]) == static_cast<std::size_t>(expected));
+    }
+
+    v[10] = 1;
+    index.update(10);
+    v[11] = 2;
+    index.update(11);
+    v[12] = 4;
+    index.update(12);
+    assert(!index.test(10) && index.test(11));
+    for (const auto& b : bounds) {
+        auto expected = std::count_if(v.begin() + static_cast<long>(b[0]), v.begin() + static_cast<long>(b[1]),
+            is_even);
+        assert(index.count(b[0], b[1]) == static_cast<std::size_t>(expected));
+    }
+
+    bool thrown = false;
+    try {
+        index.count(5, 4);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::deque<int> d{1, 2, 3};
+    auto dindex = make_range_count_index(d.begin(), d.end(), [](int i) { return i > 1; });
+    assert(dindex.count(0, 2) == 1);
+}
+
+} // namespace test
+} // namespace stl_index
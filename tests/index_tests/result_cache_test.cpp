@@ -0,0 +1,155 @@
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find_if.hpp"
+#include "index/result_cache.hpp"
+#include "index/zoned_vector.hpp"
+
+namespace stl_index {
+namespace test {
+
+namespace {
+
+int calls = 0;
+
+struct IsEven
+{
+    bool operator()(int i) const
+    {
+        ++calls;
+        return i % 2 == 0;
+    }
+};
+
+struct IsNegative
+{
+    bool operator()(int i) const
+    {
+        ++calls;
+        return i < 0;
+    }
+};
+
+struct IsMultipleOf
+{
+    int divisor;
+
+    bool operator()(int i) const
+    {
+        ++calls;
+        return i % divisor == 0;
+    }
+};
+
+struct Throws
+{
+    bool operator()(int) const
+    {
+        throw std::runtime_error("Throws");
+    }
+};
+
+} // namespace
+
+void result_cache_check()
+{
+    using range_type = cached_range<std::vector<int>>;
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<range_type::const_iterator>));
+
+    std::vector<int> v{1, 2, 3, 4, 5, 6, -7, 8};
+    result_cache cache(4);
+    range_type range(v, cache);
+    assert(range.size() == 8 && !range.empty() && &range.base() == &v);
+
+    calls = 0;
+    assert(stl_algorithm::count_if(range.begin(), range.end(), IsEven()) == 4);
+    assert(calls == 8);
+    assert(stl_algorithm::count_if(range.begin(), range.end(), IsEven()) == 4);
+    assert(calls == 8);
+    assert(cache.hits() == 1 && cache.misses() == 1 && cache.size() == 1);
+
+    // Subranges, algorithms and predicate types have their own results.
+    assert(stl_algorithm::count_if(range.begin() + 2, range.end(), IsEven()) == 3);
+    auto found = stl_algorithm::find_if(range.begin(), range.end(), IsEven());
+    assert(found == range.begin() + 1 && *found == 2 && found.container() == &range);
+    found = stl_algorithm::find_if(range.begin(), range.end(), IsNegative());
+    assert(found == range.begin() + 6);
+    assert(cache.misses() == 4 && cache.size() == 4);
+    calls = 0;
+    assert(stl_algorithm::find_if(range.begin(), range.end(), IsEven()) == range.begin() + 1);
+    assert(stl_algorithm::find_if(range.begin(), range.end(), IsNegative()) == range.begin() + 6);
+    assert(stl_algorithm::find_if(range.begin() + 7, range.end(), IsNegative()) == range.end());
+    assert(calls == 1 && cache.hits() == 3 && cache.misses() == 5);
+
+    // The least recently used result, count_if over the whole range, was evicted.
+    assert(cache.size() == 4);
+    calls = 0;
+    assert(stl_algorithm::count_if(range.begin() + 2, range.end(), IsEven()) == 3);
+    assert(calls == 0);
+    assert(stl_algorithm::count_if(range.begin(), range.end(), IsEven()) == 4);
+    assert(calls == 8);
+
+    // Modifications change the version of the range.
+    range.modify()->push_back(10);
+    assert(range.version() == 1);
+    calls = 0;
+    assert(stl_algorithm::count_if(range.begin(), range.end(), IsEven()) == 5);
+    assert(calls == 9);
+    {
+        // A result computed before a write through a kept reference is not returned after the modification.
+        auto modification = range.modify();
+        std::vector<int>& kept = *modification;
+        assert(stl_algorithm::find_if(range.begin(), range.end(), IsNegative()) == range.begin() + 6);
+        kept[0] = -1;
+        assert(range.version() == 1);
+    }
+    assert(range.version() == 2);
+    assert(stl_algorithm::find_if(range.begin(), range.end(), IsNegative()) == range.begin());
+
+    // Predicates with a state are not memoized.
+    const auto misses = cache.misses();
+    calls = 0;
+    assert(stl_algorithm::count_if(range.begin(), range.end(), IsMultipleOf{3}) == 2);
+    assert(stl_algorithm::count_if(range.begin(), range.end(), IsMultipleOf{4}) == 2);
+    assert(stl_algorithm::find_if(range.begin(), range.end(), IsMultipleOf{5}) == range.begin() + 4);
+    assert(calls == 23 && cache.misses() == misses);
+
+    // Another range over the same container has its own identity.
+    range_type other(v, cache);
+    assert(other.id() != range.id());
+    assert(stl_algorithm::count_if(other.begin(), other.end(), IsEven()) == 5);
+    assert(cache.misses() == misses + 1);
+
+    bool thrown = false;
+    try {
+        stl_algorithm::count_if(range.begin(), range.end(), Throws());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && cache.misses() == misses + 2);
+
+    cache.clear();
+    assert(cache.size() == 0 && cache.capacity() == 4);
+
+    result_cache none(0);
+    std::vector<std::string> names{"ant", "bee"};
+    cached_range<std::vector<std::string>> words(names, none);
+    auto is_bee = [](const std::string& s) { return s == "bee"; };
+    assert(stl_algorithm::find_if(words.begin(), words.end(), is_bee) == words.begin() + 1);
+    assert(stl_algorithm::find_if(words.begin(), words.end(), is_bee)->size() == 3);
+    assert(none.size() == 0 && none.misses() == 2 && none.hits() == 0);
+
+    // The iterators of cached_range and zoned_vector share their implementation, not their overloads.
+    zoned_vector<int, 4> zoned{5, 1, 8, 3, 9};
+    assert(stl_algorithm::count_if(zoned.begin(), zoned.end(), IsEven()) == 1);
+    assert(stl_algorithm::count_if(words.begin(), words.end(), make_between(std::string("b"), std::string("c"))) == 1);
+    assert(none.misses() == 2);
+}
+
+} // namespace test
+} // namespace stl_index
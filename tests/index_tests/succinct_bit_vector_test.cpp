@@ -0,0 +1,73 @@
+
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/any_of.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/find.hpp"
+#include "index/succinct_bit_vector.hpp"
+
+namespace stl_index {
+namespace test {
+
+void succinct_bit_vector_check()
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<succinct_bit_vector::const_iterator>));
+
+    {
+        std::vector<int> values{0, 3, 4, 0, 5, 0};
+        succinct_bit_vector bits(values.begin(), values.end(), [](int i) { return i > 0; });
+        assert(bits.size() == 6 && bits.count() == 3);
+        assert(bits[1] && !bits[3]);
+        assert(bits.rank(2) == 1 && bits.rank(6) == 3 && bits.rank(2, 5) == 2);
+        assert(bits.select(0) == 1 && bits.select(2) == 4 && bits.select(3) == 6);
+        assert(bits.select0(1) == 3 && bits.select0(3) == 6);
+
+        assert(stl_algorithm::count(bits.begin(), bits.end(), true) == 3);
+        assert(stl_algorithm::count(bits.begin() + 1, bits.end(), false) == 2);
+        assert(stl_algorithm::find(bits.begin() + 2, bits.end(), true) == bits.begin() + 2);
+        assert(stl_algorithm::find(bits.begin() + 5, bits.end(), true) == bits.end());
+        assert(stl_algorithm::find(bits.begin() + 1, bits.end(), false) == bits.begin() + 3);
+        assert(stl_algorithm::any_of(bits.begin(), bits.begin() + 1, [](bool b) { return b; }) == false);
+        assert(stl_algorithm::any_of(bits.begin(), bits.end(), [](bool b) { return !b; }));
+    }
+    {
+        // Crosses several superblocks and select samples, with dense and sparse regions.
+        std::mt19937 random(1);
+        std::vector<bool> flags(300001);
+        for (std::size_t i = 0; i < flags.size(); ++i) {
+            flags[i] = i < 100000 ? random() % 8 != 0 : random() % 64 == 0;
+        }
+        succinct_bit_vector bits(flags.begin(), flags.end(), [](bool b) { return b; });
+        assert(bits.size() == flags.size());
+        assert(bits.memory_usage() * 8 < flags.size() * 106 / 100 + 1024);
+
+        std::size_t ones = 0;
+        std::size_t zeros = 0;
+        for (std::size_t i = 0; i < flags.size(); ++i) {
+            if (i % 997 == 0) {
+                assert(bits.rank(i) == ones);
+            }
+            if (flags[i]) {
+                assert(bits.select(ones) == i);
+                ++ones;
+            } else {
+                assert(bits.select0(zeros) == i);
+                ++zeros;
+            }
+        }
+        assert(bits.count() == ones && bits.rank(bits.size()) == ones);
+        assert(bits.select(ones) == bits.size() && bits.select0(zeros) == bits.size());
+        assert(stl_algorithm::count(bits.begin(), bits.end(), true) == static_cast<std::ptrdiff_t>(ones));
+    }
+    {
+        succinct_bit_vector empty;
+        assert(empty.empty() && empty.count() == 0 && empty.rank(0) == 0 && empty.select(0) == 0);
+        assert(stl_algorithm::find(empty.begin(), empty.end(), true) == empty.end());
+    }
+}
+
+} // namespace test
+} // namespace stl_index
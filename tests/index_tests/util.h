@@ -0,0 +1,20 @@
+
+#ifndef __STL_INDEX_TESTS_UTIL_H__
+#define __STL_INDEX_TESTS_UTIL_H__
+
+namespace stl_index {
+namespace test {
+
+void counted_vector_check();
+void eytzinger_index_check();
+void hash_index_check();
+void range_count_index_check();
+void result_cache_check();
+void succinct_bit_vector_check();
+void wavelet_matrix_check();
+void zoned_vector_check();
+
+} // namespace test
+} // namespace stl_index
+
+#endif  // __STL_INDEX_TESTS_UTIL_H__
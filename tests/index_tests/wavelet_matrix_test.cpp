@@ -0,0 +1,77 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "index/wavelet_matrix.hpp"
+
+namespace stl_index {
+namespace test {
+
+void wavelet_matrix_check()
+{
+    {
+        std::list<int> values{5, -1, 5, 3, 7, 3, 5, -1};
+        wavelet_matrix<int> index(values.begin(), values.end());
+        assert(index.size() == 8 && index.distinct() == 4);
+        assert(index[0] == 5 && index[1] == -1 && index[7] == -1);
+        assert(index.count(0, 8, 5) == 3);
+        assert(index.count(1, 6, 3) == 2);
+        assert(index.count(0, 8, 4) == 0);
+        assert(index.count_less(0, 8, 5) == 4);
+        assert(index.count_less(2, 5, 100) == 3);
+        assert(index.count_less(0, 8, -5) == 0);
+        assert(index.kth_smallest(0, 8, 0) == -1);
+        assert(index.kth_smallest(0, 8, 7) == 7);
+        assert(index.kth_smallest(2, 6, 1) == 3 && index.kth_smallest(2, 6, 2) == 5);
+
+        bool thrown = false;
+        try {
+            index.kth_smallest(2, 2, 0);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    {
+        std::mt19937 random(3);
+        std::vector<unsigned char> values(5000);
+        for (unsigned char& value : values) {
+            value = static_cast<unsigned char>(random() % 200);
+        }
+        wavelet_matrix<unsigned char> index(values.begin(), values.end());
+        for (int query = 0; query < 200; ++query) {
+            std::size_t i = random() % values.size();
+            std::size_t j = random() % values.size();
+            if (i > j) {
+                std::swap(i, j);
+            }
+            const auto first = values.begin() + static_cast<std::ptrdiff_t>(i);
+            const auto last = values.begin() + static_cast<std::ptrdiff_t>(j);
+            const unsigned char value = values[i];
+            assert(index.count(i, j, value) == static_cast<std::size_t>(std::count(first, last, value)));
+            assert(index.count_less(i, j, value) ==
+                static_cast<std::size_t>(std::count_if(first, last, [value](unsigned char c) { return c < value; })));
+            if (i < j) {
+                std::vector<unsigned char> sorted(first, last);
+                std::sort(sorted.begin(), sorted.end());
+                const std::size_t k = random() % sorted.size();
+                assert(index.kth_smallest(i, j, k) == sorted[k]);
+            }
+        }
+    }
+    {
+        std::vector<long> same(10, 4);
+        wavelet_matrix<long> index(same.begin(), same.end());
+        assert(index.count(2, 7, 4) == 5 && index.kth_smallest(0, 10, 9) == 4 && index[3] == 4);
+
+        wavelet_matrix<int> empty;
+        assert(empty.empty() && empty.count(0, 0, 1) == 0);
+    }
+}
+
+} // namespace test
+} // namespace stl_index
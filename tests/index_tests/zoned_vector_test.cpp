@@ -0,0 +1,168 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/copy_insertable.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/any_of.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/find_if.hpp"
+#include "algorithm/none_of.hpp"
+#include "index/zoned_vector.hpp"
+
+namespace stl_index {
+namespace test {
+
+namespace {
+
+template <class Container>
+void check_zones(const Container& c)
+{
+    const std::size_t block = Container::block_size;
+    assert(c.zones().size() == (c.size() + block - 1) / block);
+    for (std::size_t z = 0; z < c.zones().size(); ++z) {
+        auto first = c.base().begin() + static_cast<std::ptrdiff_t>(z * block);
+        auto last = c.base().begin() + static_cast<std::ptrdiff_t>(std::min(c.size(), (z + 1) * block));
+        assert(c.zones()[z].min == *std::min_element(first, last));
+        assert(c.zones()[z].max == *std::max_element(first, last));
+    }
+}
+
+template <class Container>
+void check_queries(const Container& c, int low, int high)
+{
+    const auto& v = c.base();
+    const auto p = make_between(low, high);
+    for (std::size_t b = 0; b <= c.size(); b += 3) {
+        for (std::size_t e = b; e <= c.size(); e += 5) {
+            auto first = c.begin() + static_cast<std::ptrdiff_t>(b);
+            auto last = c.begin() + static_cast<std::ptrdiff_t>(e);
+            auto vfirst = v.begin() + static_cast<std::ptrdiff_t>(b);
+            auto vlast = v.begin() + static_cast<std::ptrdiff_t>(e);
+            assert(stl_algorithm::find(first, last, low).base() == std::find(vfirst, vlast, low));
+            assert(stl_algorithm::find_if(first, last, p).base() == std::find_if(vfirst, vlast, p));
+            assert(stl_algorithm::count_if(first, last, p) == std::count_if(vfirst, vlast, p));
+            assert(stl_algorithm::any_of(first, last, p) == std::any_of(vfirst, vlast, p));
+            assert(stl_algorithm::none_of(first, last, p) == std::none_of(vfirst, vlast, p));
+        }
+    }
+}
+
+} // namespace
+
+void zoned_vector_check()
+{
+    using small_type = zoned_vector<int, 4>;
+    BOOST_CONCEPT_ASSERT((stl_concept::CopyInsertable<int, zoned_vector<int>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<small_type::const_iterator>));
+
+    {
+        small_type v{5, 1, 9, 3, 10, 12, 11, 14, 20, 21};
+        assert(v.zones().size() == 3);
+        assert(v.zones()[0].min == 1 && v.zones()[0].max == 9);
+        assert(v.zones()[2].min == 20 && v.zones()[2].max == 21);
+        check_zones(v);
+
+        assert(stl_algorithm::find(v.begin(), v.end(), 12) == v.begin() + 5);
+        assert(stl_algorithm::find(v.begin(), v.end(), 13) == v.end());
+        assert(stl_algorithm::find(v.begin(), v.end(), 12L) == v.begin() + 5);
+        assert(stl_algorithm::count_if(v.begin(), v.end(), make_between(10, 19)) == 4);
+        assert(stl_algorithm::count_if(v.begin(), v.end(), make_between(0, 100)) == 10);
+        assert(stl_algorithm::find_if(v.begin(), v.end(), make_between(13, 20)) == v.begin() + 7);
+        assert(stl_algorithm::any_of(v.begin(), v.end(), make_between(2, 2)) == false);
+        assert(stl_algorithm::none_of(v.begin(), v.end(), make_between(21, 30)) == false);
+        assert(stl_algorithm::any_of(v.begin(), v.end(), make_between(2.5, 3.5)));
+        check_queries(v, 3, 11);
+
+        // Replacing a bound of a zone shrinks it, other values widen it.
+        v.replace(v.begin() + 2, 4);
+        assert(v.zones()[0].max == 5);
+        v.replace(v.begin() + 1, 0);
+        assert(v.zones()[0].min == 0);
+        v.replace(v.begin() + 1, 2);
+        assert(v.zones()[0].min == 2 && v.zones()[0].max == 5);
+        check_zones(v);
+
+        v.push_back(7);
+        v.push_back(30);
+        assert(v.zones().size() == 3 && v.zones()[2].min == 7 && v.zones()[2].max == 30);
+        v.push_back(6);
+        assert(v.zones().size() == 4);
+        v.pop_back();
+        v.pop_back();
+        assert(v.zones().size() == 3 && v.zones()[2].max == 21);
+        check_zones(v);
+
+        v.insert(v.begin() + 1, 100);
+        check_zones(v);
+        std::list<int> more{-1, 50, 8};
+        auto it = v.insert(v.begin() + 6, more.begin(), more.end());
+        assert(*it == -1);
+        check_zones(v);
+        it = v.erase(v.begin(), v.begin() + 3);
+        assert(*it == 4);
+        check_zones(v);
+        v.erase(v.end() - 1);
+        check_zones(v);
+        check_queries(v, 3, 11);
+        check_queries(v, -5, 0);
+    }
+    {
+        std::mt19937 random(3);
+        std::vector<int> values(1000);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<int>(i) / 3 + static_cast<int>(random() % 20);
+        }
+        zoned_vector<int, 16> v(values.begin(), values.end());
+        for (int i = 0; i < 500; ++i) {
+            v.replace(v.begin() + static_cast<std::ptrdiff_t>(random() % v.size()), static_cast<int>(random() % 400));
+        }
+        check_zones(v);
+        check_queries(v, 100, 130);
+        check_queries(v, 390, 500);
+    }
+    {
+        zoned_vector<std::string, 2> v(3, "b");
+        assert(v.zones().size() == 2 && v.zones()[1].min == "b");
+        v.assign({"d", "a", "c"});
+        assert(v.zones()[0].min == "a" && v.zones()[0].max == "d");
+        assert(stl_algorithm::count_if(v.begin(), v.end(), make_between(std::string("b"), std::string("d"))) == 2);
+        v.clear();
+        assert(v.empty() && v.zones().empty());
+        assert(stl_algorithm::count_if(v.begin(), v.end(), make_between(std::string("a"), std::string("z"))) == 0);
+    }
+    {
+        // The iterators follow the elements to the other vector on swap or move, and are searched by scanning then.
+        small_type a{5, 1, 9, 3, 10, 12, 11, 14, 20, 21};
+        small_type b{2, 12};
+        auto first = a.begin();
+        auto last = a.end();
+        a.swap(b);
+        assert(stl_algorithm::count_if(first, last, make_between(1, 12)) == 7);
+        assert(stl_algorithm::find_if(first, last, make_between(13, 20)).base() == b.begin().base() + 7);
+        assert(stl_algorithm::find(first, last, 12).base() == b.begin().base() + 5);
+        assert(stl_algorithm::none_of(first, last, make_between(2, 2)));
+        small_type c(std::move(b));
+        assert(stl_algorithm::count_if(first, last, make_between(1, 12)) == 7);
+        assert(stl_algorithm::any_of(first + 8, last, make_between(21, 30)));
+        assert(stl_algorithm::count_if(a.begin(), a.end(), make_between(1, 12)) == 2);
+    }
+    {
+        zoned_vector<int, 1> v;
+        v.push_back(2);
+        v.emplace_back(1);
+        assert(v.zones().size() == 2 && v.zones()[1].min == 1);
+        v.pop_back();
+        assert(v.zones().size() == 1);
+    }
+}
+
+} // namespace test
+} // namespace stl_index
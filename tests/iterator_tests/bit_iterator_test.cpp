@@ -0,0 +1,120 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/mutable_random_access_iterator.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/all_of.hpp"
+#include "algorithm/any_of.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/mismatch.hpp"
+#include "algorithm/none_of.hpp"
+#include "iterator/bit_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+bool is_set(bool b)
+{
+    return b;
+}
+
+bool is_clear(bool b)
+{
+    return !b;
+}
+
+template <class BitIt>
+void check_against_bits(BitIt first, const std::vector<char>& bits)
+{
+    const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(bits.size());
+    const std::ptrdiff_t bounds[][2] = {{0, n}, {1, n}, {3, 70}, {63, 65}, {64, 128}, {5, 5}, {n - 1, n}};
+    for (const auto& b : bounds) {
+        auto f = first + b[0];
+        auto l = first + b[1];
+        auto bf = bits.begin() + b[0];
+        auto bl = bits.begin() + b[1];
+        assert(stl_algorithm::count(f, l, true) == std::count(bf, bl, 1));
+        assert(stl_algorithm::count(f, l, false) == std::count(bf, bl, 0));
+        assert(stl_algorithm::find(f, l, true) - f == std::find(bf, bl, 1) - bf);
+        assert(stl_algorithm::find(f, l, false) - f == std::find(bf, bl, 0) - bf);
+        assert(stl_algorithm::any_of(f, l, is_set) == std::any_of(bf, bl, [](char c) { return c != 0; }));
+        assert(stl_algorithm::all_of(f, l, is_set) == std::all_of(bf, bl, [](char c) { return c != 0; }));
+        assert(stl_algorithm::none_of(f, l, is_clear) == std::none_of(bf, bl, [](char c) { return c == 0; }));
+    }
+}
+
+} // namespace
+
+void bit_iterator_check()
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::MutableRandomAccessIterator<bit_iterator<std::uint64_t>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<bit_iterator<const std::uint8_t>>));
+
+    std::mt19937 random(11);
+    std::vector<char> bits(1000);
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        bits[i] = i >= 200 && i < 330 ? 1 : static_cast<char>(random() % 2);
+    }
+    bits[999] = 0;
+
+    std::vector<bool> flags(bits.begin(), bits.end());
+    std::vector<std::uint64_t> words(16);
+    std::vector<std::uint8_t> bytes(125);
+    auto wfirst = make_bit_iterator(words.data());
+    auto bfirst = make_bit_iterator(bytes.data());
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        wfirst[static_cast<std::ptrdiff_t>(i)] = bits[i] != 0;
+        bfirst[static_cast<std::ptrdiff_t>(i)] = bits[i] != 0;
+    }
+    assert(std::equal(flags.begin(), flags.end(), wfirst));
+
+    check_against_bits(flags.begin(), bits);
+    check_against_bits(flags.cbegin(), bits);
+    check_against_bits(wfirst, bits);
+    check_against_bits(make_bit_iterator(static_cast<const std::uint8_t*>(bytes.data())), bits);
+
+    {
+        const std::vector<bool> longest(200, true);
+        assert(stl_algorithm::all_of(flags.begin() + 200, flags.begin() + 330, is_set));
+        assert(stl_algorithm::equal(longest.begin(), longest.begin() + 130, flags.begin() + 200));
+        assert(stl_algorithm::equal(flags.begin(), flags.end(), wfirst));
+        assert(stl_algorithm::equal(wfirst + 3, wfirst + 900, bfirst + 3));
+
+        auto found = stl_algorithm::mismatch(longest.begin(), longest.end(), flags.begin() + 200);
+        assert(found.first == longest.begin() + 130 && found.second == flags.begin() + 330);
+
+        // Unaligned ranges on both sides.
+        found = stl_algorithm::mismatch(longest.begin() + 5, longest.end(), flags.begin() + 207);
+        assert(found.first == longest.begin() + 128);
+
+        bfirst[600] = !bfirst[600];
+        auto wfound = stl_algorithm::mismatch(wfirst + 1, wfirst + 1000, bfirst + 1);
+        assert(wfound.first == wfirst + 600 && wfound.second == bfirst + 600);
+
+        std::list<bool> list(flags.begin(), flags.end());
+        assert(stl_algorithm::equal(flags.begin(), flags.end(), list.begin()));
+    }
+    {
+        auto it = wfirst + 5;
+        *it = true;
+        assert(*it);
+        (*it).flip();
+        assert(!*it);
+        swap(wfirst[5], wfirst[200]);
+        assert(wfirst[5] && !wfirst[200]);
+        bit_iterator<const std::uint64_t> cit = wfirst;
+        assert(cit[5] && cit == wfirst && cit + 5 - cit == 5);
+    }
+}
+
+} // namespace test
+} // namespace stl_iterator
@@ -0,0 +1,94 @@
+
+#include <cassert>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <boost/concept/assert.hpp>
+#include "concept/input_iterator.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/find_if.hpp"
+#include "algorithm/mismatch.hpp"
+#include "iterator/chunked_input_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+
+BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<chunked_input_iterator<char>>));
+BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<chunked_input_iterator<wchar_t>>));
+
+void chunked_input_iterator_check()
+{
+    const std::string text = "GET /a 200\nGET /b 404\nPOST /c 200\nGET /d 500\n";
+    const chunked_input_iterator<char> last;
+
+    {
+        std::istringstream is(text);
+        auto first = make_chunked_input_iterator(is, 7);
+        assert(stl_algorithm::count(first, last, '\n') == 4);
+        assert(first == last);
+    }
+    {
+        std::istringstream is(text);
+        chunked_input_iterator<char> first(is, 7);
+        assert(stl_algorithm::count_if(first, last, [](char c) { return c >= '0' && c <= '9'; }) == 12);
+    }
+    {
+        std::istringstream is(text);
+        chunked_input_iterator<char> first(is, 7);
+        first = stl_algorithm::find(first, last, 'P');
+        assert(first != last && *first == 'P');
+        first = stl_algorithm::find_if(first, last, [](char c) { return c == '5'; });
+        assert(*first++ == '5');
+        assert(*first == '0');
+        assert(stl_algorithm::find(first, last, 'P') == last);
+    }
+    {
+        std::istringstream is(text);
+        chunked_input_iterator<char> first(is, 5);
+        assert(stl_algorithm::equal(first, last, text.begin()));
+    }
+    {
+        std::string other = text;
+        other[30] = '#';
+        std::istringstream is1(text);
+        std::istringstream is2(other);
+        auto found = stl_algorithm::mismatch(
+            chunked_input_iterator<char>(is1, 4), last, chunked_input_iterator<char>(is2, 9));
+        assert(*found.first == text[30]);
+        assert(*found.second == '#');
+    }
+    {
+        std::istringstream is1(text);
+        std::istringstream is2(text);
+        assert(stl_algorithm::equal(chunked_input_iterator<char>(is1, 3), last, chunked_input_iterator<char>(is2)));
+    }
+    {
+        std::istringstream is("");
+        chunked_input_iterator<char> first(is);
+        assert(first == last);
+        assert(stl_algorithm::count(first, last, 'a') == 0);
+    }
+    {
+        std::wistringstream is(L"wide text");
+        chunked_input_iterator<wchar_t> first(is, 2);
+        assert(stl_algorithm::count(first, chunked_input_iterator<wchar_t>(), L't') == 2);
+    }
+#if __STL_ITERATOR_HAS_FD_INPUT
+    {
+        std::FILE* file = std::tmpfile();
+        assert(file != nullptr);
+        std::fputs(text.c_str(), file);
+        std::fflush(file);
+        std::rewind(file);
+        auto first = make_fd_input_iterator(fileno(file), 6);
+        assert(stl_algorithm::count(first, last, 'G') == 3);
+        std::fclose(file);
+    }
+#endif
+}
+
+} // namespace test
+} // namespace stl_iterator
@@ -0,0 +1,118 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/find.hpp"
+#include "iterator/dictionary_range.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+int calls = 0;
+
+bool is_short(const std::string& s)
+{
+    ++calls;
+    return s.size() < 5;
+}
+
+bool is_ready(const std::string& s)
+{
+    return s == "ready";
+}
+
+} // namespace
+
+void dictionary_range_check()
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<dictionary_iterator<std::string, std::uint8_t>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<dictionary_iterator<int, std::uint16_t>>));
+
+    const std::string states[] = {"pending", "ready", "done", "failed", "cancelled"};
+    std::mt19937 random(3);
+    std::vector<std::string> values(1000);
+    for (auto& v : values) {
+        v = states[random() % 4];
+    }
+    const dictionary_range<std::string> column(values.begin(), values.end());
+    assert(column.size() == values.size() && column.dictionary().size() == 4);
+    assert(std::equal(column.begin(), column.end(), values.begin()));
+    assert(column[17] == values[17] && column.begin()[17] == values[17]);
+
+    const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(values.size());
+    const std::ptrdiff_t bounds[][2] = {{0, n}, {1, n}, {3, 70}, {31, 33}, {40, 40}};
+    for (const auto& b : bounds) {
+        auto f = column.begin() + b[0];
+        auto l = column.begin() + b[1];
+        auto vf = values.begin() + b[0];
+        auto vl = values.begin() + b[1];
+        for (const auto& s : states) {
+            assert(stl_algorithm::count(f, l, s) == std::count(vf, vl, s));
+            assert(stl_algorithm::find(f, l, s) - f == std::find(vf, vl, s) - vf);
+        }
+        assert(stl_algorithm::count_if(f, l, is_short) == std::count_if(vf, vl, is_short));
+        assert(stl_algorithm::count_if(f, l, is_ready) == std::count_if(vf, vl, is_ready));
+        assert(stl_algorithm::equal(f, l, vf));
+    }
+    {
+        // The predicate is applied once per dictionary entry.
+        calls = 0;
+        stl_algorithm::count_if(column.begin(), column.end(), is_short);
+        assert(calls == 4);
+    }
+    {
+        std::vector<std::string> other(values);
+        other[600] = "cancelled";
+        const dictionary_range<std::string> changed(other.begin(), other.end());
+        assert(stl_algorithm::equal(column.begin(), column.end(), column.begin()));
+        assert(stl_algorithm::equal(column.begin(), column.begin() + 600, changed.begin()));
+        assert(!stl_algorithm::equal(column.begin(), column.end(), changed.begin()));
+
+        // Same values encoded with different codes.
+        std::vector<std::string> reversed(values.rbegin(), values.rend());
+        const dictionary_range<std::string, std::uint16_t> backward(reversed.rbegin(), reversed.rend());
+        assert(stl_algorithm::equal(column.begin(), column.end(), backward.begin()));
+        assert(stl_algorithm::equal(backward.begin(), backward.end(), column.begin()));
+
+        std::list<std::string> list(other.begin(), other.end());
+        assert(!stl_algorithm::equal(column.begin(), column.end(), list.begin()));
+        assert(stl_algorithm::equal(column.begin(), column.begin() + 600, list.begin()));
+    }
+    {
+        std::vector<int> numbers(300);
+        for (std::size_t i = 0; i < numbers.size(); ++i) {
+            numbers[i] = static_cast<int>(i);
+        }
+        bool thrown = false;
+        try {
+            dictionary_range<int> narrow(numbers.begin(), numbers.end());
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        const dictionary_range<int, std::uint16_t> wide(numbers.begin(), numbers.end());
+        assert(stl_algorithm::count(wide.begin(), wide.end(), 299) == 1);
+        assert(stl_algorithm::find(wide.begin(), wide.end(), 300) == wide.end());
+        // More entries than the table kept on the stack.
+        assert(stl_algorithm::count_if(wide.begin(), wide.end(), [](int i) { return i % 7 == 0; }) == 43);
+
+        const dictionary_range<int> empty;
+        assert(stl_algorithm::count(empty.begin(), empty.end(), 0) == 0);
+        assert(stl_algorithm::find(empty.begin(), empty.end(), 0) == empty.end());
+    }
+}
+
+} // namespace test
+} // namespace stl_iterator
@@ -0,0 +1,106 @@
+
+#include "iterator/file_scanner.hpp"
+
+#if __STL_ITERATOR_HAS_FILE_SCANNER
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+#include "temporary_file.h"
+
+namespace stl_iterator {
+namespace test {
+
+namespace {
+
+struct Sum
+{
+    std::int64_t sum;
+
+    void operator()(std::int32_t i)
+    {
+        sum += i;
+    }
+};
+
+void scan_check(const TemporaryFile& file, const std::vector<std::int32_t>& values, const scan_options& options)
+{
+    file_scanner<std::int32_t> scanner(file.path(), options);
+    assert(scanner.size() == values.size());
+    assert(scanner.backend() != scan_backend::automatic);
+
+    assert(stl_algorithm::find(scanner, 12345) == 12345);
+    assert(stl_algorithm::find(scanner, 99999) == values.size() - 1);
+    assert(stl_algorithm::find(scanner, -1) == scanner.size());
+    assert(stl_algorithm::count_if(scanner, [](std::int32_t i) { return i % 10 == 3; }) == 10000);
+    assert(stl_algorithm::any_of(scanner, [](std::int32_t i) { return i == 500; }));
+    assert(!stl_algorithm::any_of(scanner, [](std::int32_t i) { return i < 0; }));
+    assert(stl_algorithm::for_each(scanner, Sum{0}).sum == 4999950000);
+
+    std::size_t next = 0;
+    assert(scanner.scan([&](const std::int32_t* first, const std::int32_t* last, std::size_t offset) {
+        assert(offset == next);
+        assert(*first == values[offset]);
+        next += static_cast<std::size_t>(last - first);
+        return true;
+    }));
+    assert(next == values.size());
+}
+
+} // namespace
+
+void file_scanner_check()
+{
+    std::vector<std::int32_t> values(100000);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<std::int32_t>(i);
+    }
+    TemporaryFile file(values);
+
+    scan_options options;
+    options.buffer_size = 4096;
+    options.queue_depth = 3;
+    scan_check(file, values, options);
+
+    options.backend = scan_backend::pread;
+    scan_check(file, values, options);
+    options.direct = true;
+    scan_check(file, values, options);
+
+    options.backend = scan_backend::io_uring;
+    bool io_uring = true;
+    try {
+        file_scanner<std::int32_t> probe(file.path(), options);
+    } catch (const std::system_error&) {
+        // The kernel or the sandbox does not allow io_uring.
+        io_uring = false;
+    }
+    if (io_uring) {
+        scan_check(file, values, options);
+        options.direct = false;
+        scan_check(file, values, options);
+    }
+
+    TemporaryFile empty(std::vector<std::int32_t>{});
+    file_scanner<std::int32_t> scanner(empty.path());
+    assert(stl_algorithm::find(scanner, 0) == 0);
+    assert(stl_algorithm::count_if(scanner, [](std::int32_t) { return true; }) == 0);
+}
+
+} // namespace test
+} // namespace stl_iterator
+
+#else // __STL_ITERATOR_HAS_FILE_SCANNER
+
+namespace stl_iterator {
+namespace test {
+
+void file_scanner_check()
+{}
+
+} // namespace test
+} // namespace stl_iterator
+
+#endif // __STL_ITERATOR_HAS_FILE_SCANNER
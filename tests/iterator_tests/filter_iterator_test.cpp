@@ -0,0 +1,85 @@
+
+#include <cassert>
+#include <forward_list>
+#include <functional>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/forward_iterator.hpp"
+#include "concept/input_iterator.hpp"
+#include "algorithm/all_of.hpp"
+#include "algorithm/any_of.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/find_if.hpp"
+#include "algorithm/find_if_not.hpp"
+#include "algorithm/for_each.hpp"
+#include "algorithm/none_of.hpp"
+#include "iterator/filter_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+bool is_even(int i)
+{
+    return i % 2 == 0;
+}
+
+struct IsPositive
+{
+    bool operator()(int i) const
+    {
+        return i > 0;
+    }
+};
+
+using EvenIterator = filter_iterator<bool (*)(int), std::vector<int>::iterator>;
+BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<EvenIterator>));
+BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<filter_iterator<IsPositive, std::forward_list<int>::iterator>>));
+BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<filter_iterator<std::function<bool(int)>, const int*>>));
+
+} // namespace
+
+void filter_iterator_check()
+{
+    std::vector<int> v{-4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6};
+
+    auto evens = filtered(v, is_even);
+    assert(*evens.begin() == -4);
+    assert(stl_algorithm::count_if(evens.begin(), evens.end(), IsPositive()) == 3);
+    assert(*stl_algorithm::find_if(evens.begin(), evens.end(), IsPositive()) == 2);
+    assert(*stl_algorithm::find_if_not(evens.begin(), evens.end(), [](int i) { return i < 0; }) == 0);
+    assert(stl_algorithm::any_of(evens.begin(), evens.end(), IsPositive()));
+    assert(!stl_algorithm::all_of(evens.begin(), evens.end(), IsPositive()));
+    assert(stl_algorithm::none_of(evens.begin(), evens.end(), [](int i) { return i == 5; }));
+    assert(stl_algorithm::find_if(evens.begin(), evens.end(), [](int i) { return i > 6; }) == evens.end());
+
+    // algorithms without a fused overload accept the view as well
+    assert(stl_algorithm::count(evens.begin(), evens.end(), 4) == 1);
+    assert(*stl_algorithm::find(evens.begin(), evens.end(), 6) == 6);
+    std::vector<long> expected{-4, -2, 0, 2, 4, 6};
+    assert(stl_algorithm::equal(evens.begin(), evens.end(), expected.begin()));
+    int sum = 0;
+    (void)(stl_algorithm::for_each(evens.begin(), evens.end(), [&sum](int i) { sum += i; }));
+    assert(sum == 6);
+
+    // stacked filters
+    auto positive_evens = filtered(evens, IsPositive());
+    assert(stl_algorithm::count_if(positive_evens.begin(), positive_evens.end(), [](int i) { return i < 6; }) == 2);
+    auto it = stl_algorithm::find_if(positive_evens.begin(), positive_evens.end(), [](int i) { return i > 2; });
+    assert(*it == 4);
+    assert(*++it == 6);
+    assert(++it == positive_evens.end());
+
+    std::forward_list<int> l{3, -1, 4, -1, 5};
+    auto positives = filtered(l, IsPositive());
+    assert(stl_algorithm::count_if(positives.begin(), positives.end(), is_even) == 1);
+
+    auto empty = make_filter_iterator(is_even, v.end(), v.end());
+    assert(stl_algorithm::count_if(empty, empty, IsPositive()) == 0);
+}
+
+} // namespace test
+} // namespace stl_iterator
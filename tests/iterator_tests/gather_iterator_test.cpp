@@ -0,0 +1,47 @@
+
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/forward_iterator.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/find_if.hpp"
+#include "iterator/gather_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+
+BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<gather_iterator<int, std::vector<std::size_t>::iterator>>));
+BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<gather_iterator<const int, std::list<int>::iterator>>));
+
+void gather_iterator_check()
+{
+    std::vector<int> values{10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    std::vector<std::size_t> positions{9, 0, 3, 3, 7, 2, 8, 1, 5, 6, 4, 0};
+    std::list<int> lpositions{1, 3, 5, 7, 9};
+
+    auto first = make_gather_iterator(values.data(), positions.begin());
+    auto last = make_gather_iterator(values.data(), positions.end());
+    assert(*first == 19);
+    assert(first[4] == 17);
+
+    assert(stl_algorithm::count(first, last, 13) == 2);
+    assert(stl_algorithm::count(first, last, 20) == 0);
+    assert(stl_algorithm::count_if(first, last, [](int i) { return i < 14; }) == 6);
+    assert(stl_algorithm::find(first, last, 16) == first + 9);
+    assert(stl_algorithm::find(first, last, 20) == last);
+    assert(stl_algorithm::find_if(first, last, [](int i) { return i > 17; }) == first);
+
+    const std::vector<int>& cvalues = values;
+    auto lfirst = make_gather_iterator(cvalues.data(), lpositions.begin());
+    auto llast = make_gather_iterator(cvalues.data(), lpositions.end());
+    assert(stl_algorithm::count_if(lfirst, llast, [](int i) { return i % 2 == 1; }) == 5);
+    assert(*stl_algorithm::find(lfirst, llast, 15) == 15);
+}
+
+} // namespace test
+} // namespace stl_iterator
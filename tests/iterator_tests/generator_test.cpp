@@ -0,0 +1,133 @@
+
+#include "iterator/generator.hpp"
+
+#if __STL_ITERATOR_HAS_GENERATOR
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <boost/concept/assert.hpp>
+#include "concept/input_iterator.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find_if.hpp"
+
+namespace stl_iterator {
+namespace test {
+
+BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<generator<int>::iterator>));
+
+namespace {
+
+std::size_t allocated = 0;
+std::size_t deallocated = 0;
+
+template <class T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <class U>
+    CountingAllocator(const CountingAllocator<U>&)
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        ++allocated;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        ++deallocated;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const CountingAllocator&, const CountingAllocator&)
+    {
+        return true;
+    }
+
+    friend bool operator!=(const CountingAllocator&, const CountingAllocator&)
+    {
+        return false;
+    }
+};
+
+generator<int> iota(int n)
+{
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+generator<int> iota(std::allocator_arg_t, CountingAllocator<int>, int n)
+{
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+struct Sequence
+{
+    generator<int> iota(std::allocator_arg_t, CountingAllocator<int>, int n) const
+    {
+        for (int i = first; i < first + n; ++i) {
+            co_yield i;
+        }
+    }
+
+    int first;
+};
+
+} // namespace
+
+void generator_check()
+{
+    {
+        auto g = iota(10);
+        assert(stl_algorithm::count_if(g.begin(), g.end(), [](int i) { return i % 3 == 0; }) == 4);
+    }
+    {
+        auto g = iota(10);
+        auto it = stl_algorithm::find_if(g.begin(), g.end(), [](int i) { return i > 6; });
+        assert(it != g.end() && *it == 7);
+        assert(*it++ == 7);
+        assert(*it == 8);
+    }
+    {
+        auto g = iota(0);
+        assert(g.begin() == g.end());
+    }
+    {
+        auto g = iota(std::allocator_arg, CountingAllocator<int>(), 100);
+        assert(allocated == 1);
+        assert(stl_algorithm::count_if(g.begin(), g.end(), [](int i) { return i < 50; }) == 50);
+    }
+    assert(deallocated == 1);
+    {
+        const Sequence sequence = {10};
+        auto g = sequence.iota(std::allocator_arg, CountingAllocator<int>(), 5);
+        assert(allocated == 2);
+        auto it = stl_algorithm::find_if(g.begin(), g.end(), [](int i) { return i % 7 == 0; });
+        assert(it != g.end() && *it == 14);
+    }
+    assert(deallocated == 2);
+}
+
+} // namespace test
+} // namespace stl_iterator
+
+#else // __STL_ITERATOR_HAS_GENERATOR
+
+namespace stl_iterator {
+namespace test {
+
+void generator_check()
+{}
+
+} // namespace test
+} // namespace stl_iterator
+
+#endif // __STL_ITERATOR_HAS_GENERATOR
@@ -0,0 +1,23 @@
+
+#include "util.h"
+
+int main()
+{
+    using namespace stl_iterator::test;
+
+    bit_iterator_check();
+    chunked_input_iterator_check();
+    dictionary_range_check();
+    file_scanner_check();
+    filter_iterator_check();
+    gather_iterator_check();
+    generator_check();
+    mapped_file_check();
+    packed_range_check();
+    rle_range_check();
+    strided_iterator_check();
+    transform_iterator_check();
+    zip_iterator_check();
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+
+#include "iterator/mapped_file.hpp"
+
+#if __STL_ITERATOR_HAS_MAPPED_FILE
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+#include "algorithm/count.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/find.hpp"
+#include "temporary_file.h"
+
+namespace stl_iterator {
+namespace test {
+
+void mapped_file_check()
+{
+    std::vector<std::int32_t> values(100000);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<std::int32_t>(i % 1000);
+    }
+    TemporaryFile file(values);
+
+    {
+        mapped_file_range<std::int32_t> range(file.path());
+        assert(range.size() == values.size());
+        assert(stl_algorithm::equal(range.begin(), range.end(), values.begin()));
+        assert(stl_algorithm::count(range.begin(), range.end(), 7) == 100);
+        assert(stl_algorithm::find(range.begin(), range.end(), 999) == range.begin() + 999);
+
+        range.advise(access_pattern::random);
+        mapped_file_range<std::int32_t> moved(std::move(range));
+        assert(range.empty());
+        assert(moved.size() == values.size());
+    }
+    {
+        mapped_file_range<char> bytes(file.path(), access_pattern::repeated);
+        assert(bytes.size() == values.size() * sizeof(std::int32_t));
+    }
+    {
+        // Windows of 4096 elements sharing 1 element, so that the pair (999, 0) is found across boundaries.
+        mapped_file_window<std::int32_t> window(file.path(), 4096, 1);
+        assert(window.file_size() == values.size());
+        const std::int32_t pair[] = {999, 0};
+        std::ptrdiff_t sevens = 0;
+        std::ptrdiff_t pairs = 0;
+        std::size_t windows = 0;
+        do {
+            assert(window.size() <= 4096);
+            assert(stl_algorithm::equal(window.begin(), window.end(), values.data() + window.offset()));
+            const std::int32_t* first = window.begin() + (window.offset() == 0 ? 0 : 1);
+            sevens += stl_algorithm::count(first, window.end(), 7);
+            for (auto it = window.begin(); it != window.end(); ++it) {
+                it = std::search(it, window.end(), pair, pair + 2);
+                if (it == window.end()) {
+                    break;
+                }
+                ++pairs;
+            }
+            ++windows;
+        } while (window.next());
+        assert(sevens == 100);
+        assert(pairs == 99);
+        assert(windows == 25);
+
+        window.seek(values.size() - 10);
+        assert(window.size() == 10);
+        assert(*window.begin() == values[values.size() - 10]);
+
+        window.seek(values.size());
+        assert(window.empty() && window.offset() == values.size() && !window.next());
+
+        window.seek(0);
+        bool thrown = false;
+        try {
+            window.seek(values.size() + 1);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(window.offset() == 0 && window.size() == 4096 && *window.begin() == values[0]);
+    }
+    {
+        std::vector<std::int32_t> empty;
+        TemporaryFile empty_file(empty);
+        mapped_file_range<std::int32_t> range(empty_file.path());
+        assert(range.empty() && range.begin() == range.end());
+        mapped_file_window<std::int32_t> window(empty_file.path(), 16);
+        assert(window.empty() && !window.next());
+    }
+    {
+        bool thrown = false;
+        try {
+            mapped_file_range<char> missing("/nonexistent/stl_mapped_file");
+        } catch (const std::system_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+}
+
+} // namespace test
+} // namespace stl_iterator
+
+#else // __STL_ITERATOR_HAS_MAPPED_FILE
+
+namespace stl_iterator {
+namespace test {
+
+void mapped_file_check()
+{}
+
+} // namespace test
+} // namespace stl_iterator
+
+#endif // __STL_ITERATOR_HAS_MAPPED_FILE
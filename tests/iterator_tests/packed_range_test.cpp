@@ -0,0 +1,119 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <random>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/forward_iterator.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/mismatch.hpp"
+#include "iterator/packed_range.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+template <class T>
+bool is_positive(T value)
+{
+    return value > 0;
+}
+
+template <class Range, class T>
+void check_against_values(const Range& range, const std::vector<T>& values)
+{
+    assert(range.size() == values.size());
+    assert(std::equal(range.begin(), range.end(), values.begin()));
+
+    const std::size_t n = values.size();
+    const std::size_t bounds[][2] = {{0, n}, {1, n}, {3, 70}, {63, 65}, {64, 128}, {5, 5}, {n - 1, n}};
+    for (const auto& bound : bounds) {
+        const std::size_t b[] = {std::min(bound[0], n), std::min(bound[1], n)};
+        auto f = range.iterator_at(b[0]);
+        auto l = range.iterator_at(b[1]);
+        auto vf = values.begin() + static_cast<std::ptrdiff_t>(b[0]);
+        auto vl = values.begin() + static_cast<std::ptrdiff_t>(b[1]);
+        for (std::size_t i = b[0]; i < b[1]; i += 7) {
+            const T value = values[i];
+            assert(stl_algorithm::count(f, l, value) == std::count(vf, vl, value));
+            assert(stl_algorithm::find(f, l, value).index() - b[0] == static_cast<std::size_t>(
+                std::find(vf, vl, value) - vf));
+        }
+        assert(stl_algorithm::count_if(f, l, is_positive<T>) == std::count_if(vf, vl, is_positive<T>));
+        assert(stl_algorithm::find(f, l, T(1) + T(2)) == l || *stl_algorithm::find(f, l, T(1) + T(2)) == T(3));
+        assert(stl_algorithm::mismatch(f, l, vf).first == l);
+    }
+}
+
+} // namespace
+
+void packed_range_check()
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<frame_of_reference_range<std::int32_t>::const_iterator>));
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<delta_range<std::uint64_t>::const_iterator>));
+
+    std::mt19937 random(7);
+    {
+        std::vector<std::int32_t> values(1000);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<std::int32_t>(random() % 200) - 100 + (i >= 500 ? 100000 : 0);
+        }
+        const frame_of_reference_range<std::int32_t> samples(values.begin(), values.end());
+        check_against_values(samples, values);
+        check_against_values(delta_range<std::int32_t>(values.begin(), values.end()), values);
+        assert(samples.memory_usage() < values.size() * sizeof(std::int32_t));
+
+        // Values of another integral type, some of them not representable.
+        assert(stl_algorithm::count(samples.begin(), samples.end(), std::int64_t(values[10])) ==
+            std::count(values.begin(), values.end(), values[10]));
+        assert(stl_algorithm::count(samples.begin(), samples.end(), std::int64_t(1) << 40) == 0);
+        assert(stl_algorithm::find(samples.begin(), samples.end(), std::uint32_t(-1)) == samples.end());
+
+        std::list<std::int32_t> list(values.begin(), values.end());
+        *std::next(list.begin(), 700) = 0;
+        auto found = stl_algorithm::mismatch(samples.begin(), samples.end(), list.begin());
+        assert(found.first.index() == 700 && *found.second == 0);
+    }
+    {
+        std::vector<std::uint64_t> timestamps(3000);
+        std::uint64_t t = 1600000000000u;
+        for (auto& v : timestamps) {
+            v = t += 1000 + random() % 16;
+        }
+        timestamps[1234] = 5;
+        const delta_range<std::uint64_t> series(timestamps.begin(), timestamps.end());
+        check_against_values(series, timestamps);
+        assert(series.memory_usage() < timestamps.size() * 2);
+        assert(stl_algorithm::find(series.begin(), series.end(), 5u).index() == 1234);
+    }
+    {
+        std::vector<std::int8_t> extremes(200);
+        for (std::size_t i = 0; i < extremes.size(); ++i) {
+            extremes[i] = i % 3 == 0 ? std::numeric_limits<std::int8_t>::min()
+                                     : std::numeric_limits<std::int8_t>::max();
+        }
+        check_against_values(frame_of_reference_range<std::int8_t>(extremes.begin(), extremes.end()), extremes);
+        check_against_values(delta_range<std::int8_t>(extremes.begin(), extremes.end()), extremes);
+
+        std::vector<std::uint64_t> wide{0, ~std::uint64_t(0), 1, std::uint64_t(1) << 63, 7};
+        check_against_values(frame_of_reference_range<std::uint64_t>(wide.begin(), wide.end()), wide);
+        check_against_values(delta_range<std::uint64_t>(wide.begin(), wide.end()), wide);
+
+        const frame_of_reference_range<std::uint16_t> constant{9, 9, 9};
+        assert(stl_algorithm::count(constant.begin(), constant.end(), 9) == 3);
+        assert(stl_algorithm::count(constant.begin(), constant.end(), -9) == 0);
+
+        const delta_range<int> empty;
+        assert(empty.begin() == empty.end());
+        assert(stl_algorithm::count(empty.begin(), empty.end(), 0) == 0);
+    }
+}
+
+} // namespace test
+} // namespace stl_iterator
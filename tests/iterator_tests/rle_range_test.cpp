@@ -0,0 +1,114 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/forward_iterator.hpp"
+#include "algorithm/all_of.hpp"
+#include "algorithm/any_of.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/mismatch.hpp"
+#include "algorithm/none_of.hpp"
+#include "iterator/rle_range.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+int calls = 0;
+
+bool is_odd(int i)
+{
+    ++calls;
+    return i % 2 != 0;
+}
+
+bool is_small(int i)
+{
+    return i < 5;
+}
+
+} // namespace
+
+void rle_range_check()
+{
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<rle_iterator<int>>));
+    BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<rle_iterator<std::string>>));
+
+    std::mt19937 random(5);
+    std::vector<int> values;
+    while (values.size() < 1000) {
+        values.insert(values.end(), random() % 40 + 1, static_cast<int>(random() % 6));
+    }
+    const rle_range<int> column(values.begin(), values.end());
+    assert(column.size() == values.size());
+    assert(column.run_count() < 100);
+    assert(std::equal(column.begin(), column.end(), values.begin()));
+
+    const std::size_t bounds[][2] = {{0, values.size()}, {1, values.size()}, {3, 70}, {17, 18}, {40, 40}};
+    for (const auto& b : bounds) {
+        auto f = column.iterator_at(b[0]);
+        auto l = column.iterator_at(b[1]);
+        auto vf = values.begin() + static_cast<std::ptrdiff_t>(b[0]);
+        auto vl = values.begin() + static_cast<std::ptrdiff_t>(b[1]);
+        for (int v = 0; v < 7; ++v) {
+            assert(stl_algorithm::count(f, l, v) == std::count(vf, vl, v));
+            assert(std::distance(f, stl_algorithm::find(f, l, v)) == std::find(vf, vl, v) - vf);
+        }
+        assert(stl_algorithm::count_if(f, l, is_odd) == std::count_if(vf, vl, is_odd));
+        assert(stl_algorithm::all_of(f, l, is_small) == std::all_of(vf, vl, is_small));
+        assert(stl_algorithm::any_of(f, l, is_odd) == std::any_of(vf, vl, is_odd));
+        assert(stl_algorithm::none_of(f, l, is_odd) == std::none_of(vf, vl, is_odd));
+        assert(stl_algorithm::equal(f, l, vf));
+    }
+    {
+        // The predicate is applied once per run.
+        calls = 0;
+        stl_algorithm::count_if(column.begin(), column.end(), is_odd);
+        assert(static_cast<std::size_t>(calls) == column.run_count());
+    }
+    {
+        std::vector<int> other(values);
+        other[700] = 9;
+        const rle_range<int> changed(other.begin(), other.end());
+        assert(stl_algorithm::equal(column.begin(), column.end(), column.begin()));
+        assert(!stl_algorithm::equal(column.begin(), column.end(), changed.begin()));
+
+        auto found = stl_algorithm::mismatch(column.begin(), column.end(), changed.begin());
+        assert(found.first.index() == 700 && found.second.index() == 700 && *found.second == 9);
+
+        // Runs of the two ranges start at different positions.
+        found = stl_algorithm::mismatch(column.iterator_at(3), column.end(), changed.iterator_at(3));
+        assert(found.first.index() == 700);
+
+        std::list<int> list(other.begin(), other.end());
+        auto lfound = stl_algorithm::mismatch(column.begin(), column.end(), list.begin());
+        assert(lfound.first.index() == 700 && *lfound.second == 9);
+    }
+    {
+        rle_range<std::string> words{"a", "a", "b"};
+        words.push_back("b", 3);
+        words.push_back("c", 0);
+        assert(words.size() == 6 && words.run_count() == 2);
+        assert(stl_algorithm::count(words.begin(), words.end(), std::string("b")) == 4);
+        assert(stl_algorithm::find(words.begin(), words.end(), std::string("c")) == words.end());
+        assert(words.begin()->size() == 1);
+        assert(words == rle_range<std::string>({"a", "a", "b", "b", "b", "b"}));
+
+        const rle_range<int> empty;
+        assert(empty.begin() == empty.end());
+        assert(stl_algorithm::count(empty.begin(), empty.end(), 0) == 0);
+        assert(stl_algorithm::all_of(empty.begin(), empty.end(), is_odd));
+    }
+}
+
+} // namespace test
+} // namespace stl_iterator
@@ -0,0 +1,116 @@
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/random_access_iterator.hpp"
+#include "concept/mutable_random_access_iterator.hpp"
+#include "algorithm/count.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/find_if.hpp"
+#include "algorithm/for_each.hpp"
+#include "iterator/strided_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<strided_iterator<int>>));
+BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<strided_iterator<const double>>));
+BOOST_CONCEPT_ASSERT((stl_concept::MutableRandomAccessIterator<strided_iterator<int>>));
+
+struct Trade
+{
+    std::int32_t id;
+    double price;
+    char side;
+};
+
+struct Label
+{
+    explicit Label(std::string name)
+        : name(std::move(name))
+    {}
+
+    std::string name;
+};
+
+bool is_odd(std::int32_t i)
+{
+    return i % 2 != 0;
+}
+
+} // namespace
+
+void strided_iterator_check()
+{
+    std::vector<Trade> trades;
+    for (std::int32_t i = 0; i < 37; ++i) {
+        trades.push_back(Trade{i % 5, 0.5 * i, i % 2 ? 'b' : 's'});
+    }
+
+    auto first = make_member_iterator(trades.data(), &Trade::id);
+    auto last = first + static_cast<std::ptrdiff_t>(trades.size());
+    assert(last - first == 37);
+    assert(first[6] == 1);
+    assert(*(last - 1) == 36 % 5);
+
+    assert(stl_algorithm::count(first, last, 4) == 7);
+    assert(stl_algorithm::count(first, last, 5) == 0);
+    assert(stl_algorithm::count(first + 1, last, 0) == 7);
+    assert(stl_algorithm::count_if(first, last, is_odd) == 15);
+    assert(stl_algorithm::find(first, last, 3) == first + 3);
+    assert(stl_algorithm::find(first + 4, last, 3) == first + 8);
+    assert(stl_algorithm::find(first, last, 7) == last);
+    assert(stl_algorithm::find_if(first + 1, last, [](std::int32_t i) { return i == 0; }) == first + 5);
+
+    const std::vector<Trade>& ctrades = trades;
+    auto pfirst = make_member_iterator(ctrades.data(), &Trade::price);
+    auto plast = pfirst + static_cast<std::ptrdiff_t>(ctrades.size());
+    assert(stl_algorithm::count_if(pfirst, plast, [](double d) { return d >= 10.0; }) == 17);
+    assert(stl_algorithm::find(pfirst, plast, 3.5) == pfirst + 7);
+
+    // every third sample of an interleaved signal, scanned backwards
+    std::vector<std::int32_t> signal(30);
+    for (std::size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = static_cast<std::int32_t>(i % 3 == 1 ? i : 0);
+    }
+    auto sfirst = make_strided_iterator(signal.data() + 1, 3);
+    auto slast = sfirst + 10;
+    assert(stl_algorithm::count(sfirst, slast, 0) == 0);
+    auto rfirst = make_strided_iterator(signal.data() + 28, -3);
+    auto rlast = rfirst + 10;
+    assert(rfirst < rlast);
+    assert(stl_algorithm::find(rfirst, rlast, 4) == rfirst + 8);
+
+    // The predicate is not called past the element found.
+    int calls = 0;
+    auto found = stl_algorithm::find_if(first, last, [&calls](std::int32_t i) { return ++calls, i == 2; });
+    assert(found == first + 2 && calls == 3);
+
+    // Elements which are not trivial are tested in place.
+    std::vector<Label> labels;
+    for (int i = 0; i < 20; ++i) {
+        labels.push_back(Label(i % 4 == 3 ? "x" : "y"));
+    }
+    auto lfirst = make_member_iterator(labels.data(), &Label::name);
+    auto llast = lfirst + 20;
+    assert(stl_algorithm::count(lfirst, llast, std::string("x")) == 5);
+    assert(stl_algorithm::find(lfirst, llast, std::string("x")) == lfirst + 3);
+    assert(stl_algorithm::count_if(lfirst, llast, [](const std::string& s) { return s == "y"; }) == 15);
+    calls = 0;
+    auto lfound = stl_algorithm::find_if(lfirst, llast, [&calls](const std::string& s) { return ++calls, s == "x"; });
+    assert(lfound == lfirst + 3 && calls == 4);
+    auto wfirst = make_strided_iterator(labels.data(), 1);
+    assert(stl_algorithm::find_if(wfirst, wfirst + 20, [](const Label& l) { return l.name == "x"; }) == wfirst + 3);
+
+    (void)(stl_algorithm::for_each(sfirst, slast, [](std::int32_t& i) { i = 1; }));
+    assert(stl_algorithm::count(sfirst, slast, 1) == 10);
+    assert(signal[0] == 0 && signal[1] == 1 && signal[4] == 1);
+}
+
+} // namespace test
+} // namespace stl_iterator
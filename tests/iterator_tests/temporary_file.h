@@ -0,0 +1,49 @@
+#ifndef __STL_ITERATOR_TESTS_TEMPORARY_FILE_H__
+#define __STL_ITERATOR_TESTS_TEMPORARY_FILE_H__
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace stl_iterator {
+namespace test {
+
+/** @brief Temporary file holding the bytes of a vector, removed on destruction. */
+class TemporaryFile
+{
+public:
+    template <class T>
+    explicit TemporaryFile(const std::vector<T>& content)
+        : path_("/tmp/stl_iterator_test_XXXXXX")
+    {
+        const int fd = ::mkstemp(&path_[0]);
+        assert(fd >= 0);
+        const std::size_t size = content.size() * sizeof(T);
+        const ::ssize_t written = ::write(fd, content.data(), size);
+        assert(written == static_cast<::ssize_t>(size));
+        ::close(fd);
+    }
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    ~TemporaryFile()
+    {
+        ::unlink(path_.c_str());
+    }
+
+    const std::string& path() const
+    {
+        return path_;
+    }
+
+private:
+    std::string path_;
+};
+
+} // namespace test
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_TESTS_TEMPORARY_FILE_H__
@@ -0,0 +1,78 @@
+
+#include <cassert>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/bidirectional_iterator.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/all_of.hpp"
+#include "algorithm/any_of.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find.hpp"
+#include "algorithm/find_if.hpp"
+#include "algorithm/find_if_not.hpp"
+#include "algorithm/mismatch.hpp"
+#include "algorithm/none_of.hpp"
+#include "iterator/filter_iterator.hpp"
+#include "iterator/transform_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+int square(int i)
+{
+    return i * i;
+}
+
+struct Length
+{
+    std::size_t operator()(const std::string& s) const
+    {
+        return s.size();
+    }
+};
+
+BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<transform_iterator<int (*)(int), std::vector<int>::iterator>>));
+BOOST_CONCEPT_ASSERT((stl_concept::BidirectionalIterator<transform_iterator<Length, std::list<std::string>::iterator>>));
+
+} // namespace
+
+void transform_iterator_check()
+{
+    std::vector<int> v{-3, -2, -1, 0, 1, 2, 3};
+
+    auto squares = transformed(v, square);
+    assert(squares.end() - squares.begin() == 7);
+    assert(squares.begin()[1] == 4);
+    assert(stl_algorithm::count_if(squares.begin(), squares.end(), [](int i) { return i > 1; }) == 4);
+    assert(stl_algorithm::find_if(squares.begin(), squares.end(), [](int i) { return i < 4; }) == squares.begin() + 2);
+    assert(stl_algorithm::find_if_not(squares.begin(), squares.end(), [](int i) { return i > 0; }).base() == v.begin() + 3);
+    assert(stl_algorithm::all_of(squares.begin(), squares.end(), [](int i) { return i >= 0; }));
+    assert(stl_algorithm::any_of(squares.begin(), squares.end(), [](int i) { return i == 9; }));
+    assert(stl_algorithm::none_of(squares.begin(), squares.end(), [](int i) { return i == 2; }));
+    assert(*stl_algorithm::find(squares.begin(), squares.end(), 1) == 1);
+
+    std::vector<int> expected{9, 4, 1, 0, 1, 4, 8};
+    auto p = stl_algorithm::mismatch(squares.begin(), squares.end(), expected.begin());
+    assert(*p.first == 9 && *p.second == 8);
+
+    // filter -> transform -> count_if runs as a single loop over v
+    auto odd_squares = transformed(filtered(v, [](int i) { return i % 2 != 0; }), square);
+    assert(stl_algorithm::count_if(odd_squares.begin(), odd_squares.end(), [](int i) { return i > 1; }) == 2);
+    auto found = stl_algorithm::find_if(odd_squares.begin(), odd_squares.end(), [](int i) { return i == 1; });
+    assert(found.base().base() == v.begin() + 2);
+    assert(*++found == 1);
+
+    // transform -> filter
+    auto large_squares = filtered(transformed(v, square), [](int i) { return i > 3; });
+    assert(stl_algorithm::count_if(large_squares.begin(), large_squares.end(), [](int i) { return i < 9; }) == 2);
+
+    std::list<std::string> words{"a", "bb", "ccc"};
+    auto lengths = transformed(words, Length());
+    assert(stl_algorithm::count_if(lengths.begin(), lengths.end(), [](std::size_t n) { return n > 1; }) == 2);
+}
+
+} // namespace test
+} // namespace stl_iterator
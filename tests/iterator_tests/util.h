@@ -0,0 +1,25 @@
+
+#ifndef __STL_ITERATOR_TESTS_UTIL_H__
+#define __STL_ITERATOR_TESTS_UTIL_H__
+
+namespace stl_iterator {
+namespace test {
+
+void bit_iterator_check();
+void chunked_input_iterator_check();
+void dictionary_range_check();
+void file_scanner_check();
+void filter_iterator_check();
+void gather_iterator_check();
+void generator_check();
+void mapped_file_check();
+void packed_range_check();
+void rle_range_check();
+void strided_iterator_check();
+void transform_iterator_check();
+void zip_iterator_check();
+
+} // namespace test
+} // namespace stl_iterator
+
+#endif  // __STL_ITERATOR_TESTS_UTIL_H__
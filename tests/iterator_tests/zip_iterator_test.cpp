@@ -0,0 +1,90 @@
+
+#include <cassert>
+#include <list>
+#include <tuple>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include "concept/input_iterator.hpp"
+#include "concept/forward_iterator.hpp"
+#include "concept/bidirectional_iterator.hpp"
+#include "concept/random_access_iterator.hpp"
+#include "algorithm/count_if.hpp"
+#include "algorithm/find_if.hpp"
+#include "algorithm/for_each.hpp"
+#include "iterator/zip_iterator.hpp"
+
+namespace stl_iterator {
+namespace test {
+namespace {
+
+using VectorZip = zip_iterator<std::vector<int>::iterator, std::vector<double>::iterator>;
+using PointerZip = zip_iterator<const int*, const double*, const char*>;
+using ListZip = zip_iterator<std::vector<int>::iterator, std::list<double>::iterator>;
+
+BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<VectorZip>));
+BOOST_CONCEPT_ASSERT((stl_concept::RandomAccessIterator<PointerZip>));
+BOOST_CONCEPT_ASSERT((stl_concept::BidirectionalIterator<ListZip>));
+BOOST_CONCEPT_ASSERT((stl_concept::ForwardIterator<ListZip>));
+BOOST_CONCEPT_ASSERT((stl_concept::InputIterator<ListZip>));
+
+bool is_negative(int i)
+{
+    return i < 0;
+}
+
+struct Sum
+{
+    void operator()(int i, double d)
+    {
+        sum += i + d;
+    }
+
+    double sum = 0.0;
+};
+
+} // namespace
+
+void zip_iterator_check()
+{
+    std::vector<int> ids{1, -2, 3, -4, 5};
+    std::vector<double> prices{1.5, 2.5, 3.5, 4.5, 5.5};
+    std::list<double> weights{1.0, 2.0, 3.0, 4.0, 5.0};
+
+    auto first = make_zip_iterator(ids.begin(), prices.begin());
+    auto last = make_zip_iterator(ids.end(), prices.end());
+    assert(last - first == 5);
+    assert(std::get<1>(first[2]) == 3.5);
+
+    // proxy reference writes through to the underlying ranges
+    std::get<1>(*first) = 0.5;
+    assert(prices[0] == 0.5);
+
+    auto row = [](std::tuple<int&, double&> r) { return std::get<0>(r) > 0 && std::get<1>(r) > 3.0; };
+    assert(stl_algorithm::find_if(first, last, row) == first + 2);
+    assert(stl_algorithm::count_if(first, last, row) == 2);
+
+    auto negative = columns<0>(is_negative);
+    assert(stl_algorithm::find_if(first, last, negative) == first + 1);
+    assert(stl_algorithm::find_if_not(first + 1, last, negative) == first + 2);
+    assert(stl_algorithm::count_if(first, last, negative) == 2);
+    assert(stl_algorithm::any_of(first, last, negative));
+    assert(!stl_algorithm::all_of(first, last, negative));
+    assert(!stl_algorithm::none_of(first, last, negative));
+
+    auto expensive = columns<1, 0>([](double d, int i) { return d > 3.0 && i > 0; });
+    assert(stl_algorithm::find_if(first, last, expensive) == first + 2);
+    assert(stl_algorithm::count_if(first, last, expensive) == 2);
+
+    auto sum = stl_algorithm::for_each(first, last, columns<0, 1>(Sum()));
+    assert(sum.function().sum == 3.0 + 0.5 + 2.5 + 3.5 + 4.5 + 5.5);
+
+    auto lfirst = make_zip_iterator(ids.begin(), weights.begin());
+    auto llast = make_zip_iterator(ids.end(), weights.end());
+    auto heavy = columns<1>([](double w) { return w > 3.0; });
+    assert(std::get<0>(*stl_algorithm::find_if(lfirst, llast, heavy)) == -4);
+    assert(stl_algorithm::count_if(lfirst, llast, heavy) == 2);
+    assert(stl_algorithm::count_if(lfirst, llast, columns<0>(is_negative)) == 2);
+}
+
+} // namespace test
+} // namespace stl_iterator